@@ -0,0 +1,23 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "Attribute.h"
+
+namespace lepong::Cpu
+{
+
+///
+/// \return Whether the code built for SSE2 can run. Always false when not building for x86.
+///
+LEPONG_NODISCARD bool HasSSE2() noexcept;
+
+///
+/// \return Whether the code built for AVX2 can run, which requires support from both the CPU and the OS.<br>
+/// Always false when not building for x86.
+///
+LEPONG_NODISCARD bool HasAVX2() noexcept;
+
+} // namespace lepong::Cpu
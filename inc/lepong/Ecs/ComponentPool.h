@@ -0,0 +1,142 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Check.h"
+
+namespace lepong::Ecs
+{
+
+///
+/// An entity is only an index, its data lives in the component pools.
+///
+using Entity = std::uint32_t;
+
+static constexpr Entity skNullEntity = ~Entity{ 0 };
+
+///
+/// Stores one type of component for any number of entities.<br><br>
+///
+/// The components are packed in a dense array so systems iterate over contiguous memory. A sparse array maps each
+/// entity to its component, which makes insertion, removal and lookup constant time. Removing swaps the last component
+/// into the hole so the order of the dense array changes.
+///
+template<typename Component>
+class ComponentPool
+{
+public:
+    ///
+    /// Adds a component to an entity, or replaces the one it has.
+    ///
+    Component& Insert(Entity entity, const Component& component) noexcept
+    {
+        if (entity >= mSparse.size())
+        {
+            mSparse.resize(static_cast<std::size_t>(entity) + 1, skNullEntity);
+        }
+
+        if (mSparse[entity] != skNullEntity)
+        {
+            return mComponents[mSparse[entity]] = component;
+        }
+
+        mSparse[entity] = static_cast<std::uint32_t>(mEntities.size());
+
+        mEntities.push_back(entity);
+        mComponents.push_back(component);
+
+        return mComponents.back();
+    }
+
+    ///
+    /// Removes the component of an entity, does nothing if it doesn't have one.
+    ///
+    void Remove(Entity entity) noexcept
+    {
+        LEPONG_CHECK_OR_RETURN(Has(entity));
+
+        const auto kIndex = mSparse[entity];
+        const auto kLast = mEntities.back();
+
+        mEntities[kIndex] = kLast;
+        mComponents[kIndex] = mComponents.back();
+        mSparse[kLast] = kIndex;
+
+        mEntities.pop_back();
+        mComponents.pop_back();
+        mSparse[entity] = skNullEntity;
+    }
+
+    void Reserve(std::size_t count) noexcept
+    {
+        mEntities.reserve(count);
+        mComponents.reserve(count);
+    }
+
+public:
+    LEPONG_NODISCARD bool Has(Entity entity) const noexcept
+    {
+        return entity < mSparse.size() && mSparse[entity] != skNullEntity;
+    }
+
+    ///
+    /// \return The component of the entity, which must have one.
+    ///
+    LEPONG_NODISCARD Component& Get(Entity entity) noexcept
+    {
+        return mComponents[mSparse[entity]];
+    }
+
+    LEPONG_NODISCARD const Component& Get(Entity entity) const noexcept
+    {
+        return mComponents[mSparse[entity]];
+    }
+
+    ///
+    /// \return The index of the entity's component in the dense array, which it must have.
+    ///
+    LEPONG_NODISCARD std::uint32_t GetIndex(Entity entity) const noexcept
+    {
+        return mSparse[entity];
+    }
+
+public:
+    LEPONG_NODISCARD std::size_t Size() const noexcept
+    {
+        return mComponents.size();
+    }
+
+    LEPONG_NODISCARD Component* Data() noexcept
+    {
+        return mComponents.data();
+    }
+
+    LEPONG_NODISCARD const Component* Data() const noexcept
+    {
+        return mComponents.data();
+    }
+
+    ///
+    /// \return The entity owning each component of the dense array.
+    ///
+    LEPONG_NODISCARD const Entity* Entities() const noexcept
+    {
+        return mEntities.data();
+    }
+
+private:
+    // Entity to dense index, skNullEntity for entities without the component.
+    std::vector<std::uint32_t> mSparse;
+
+    std::vector<Entity> mEntities;
+    std::vector<Component> mComponents;
+};
+
+} // namespace lepong::Ecs
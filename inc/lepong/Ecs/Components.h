@@ -0,0 +1,55 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Math/Vector2.h"
+
+namespace lepong::Ecs
+{
+
+// Components are plain data, the systems hold the logic. They are split by what reads them so that a system only
+// pulls what it needs into the cache.
+
+struct Transform
+{
+    Vector2f position;
+};
+
+///
+/// Same as the motion part of <i>GameObject</i>.
+///
+struct Velocity
+{
+    Vector2f direction;
+    float speed = 0.0f;
+};
+
+enum class ColliderShape : std::uint32_t
+{
+    Circle,
+    Box
+};
+
+struct Collider
+{
+    ColliderShape shape = ColliderShape::Circle;
+
+    // For circles, x is the radius.
+    Vector2f halfSize;
+};
+
+///
+/// What to draw an entity with. The handles are the renderer's, OpenGL names for the game, the simulation never looks
+/// at them.
+///
+struct RenderBinding
+{
+    std::uint32_t mesh = 0;
+    std::uint32_t program = 0;
+};
+
+} // namespace lepong::Ecs
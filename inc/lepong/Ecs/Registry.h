@@ -0,0 +1,70 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "lepong/Attribute.h"
+
+#include "ComponentPool.h"
+#include "Components.h"
+
+namespace lepong::Ecs
+{
+
+///
+/// Creates entities and owns one pool per component type.
+///
+class Registry
+{
+public:
+    ComponentPool<Transform> transforms;
+    ComponentPool<Velocity> velocities;
+    ComponentPool<Collider> colliders;
+    ComponentPool<RenderBinding> renderBindings;
+
+public:
+    ///
+    /// \return A new entity without any component. Destroyed entities are reused.
+    ///
+    LEPONG_NODISCARD Entity Create() noexcept;
+
+    ///
+    /// Removes every component of the entity and frees it. Destroying an entity that doesn't exist does nothing.
+    ///
+    void Destroy(Entity entity) noexcept;
+
+    ///
+    /// Reserves room for <i>count</i> entities with every component.
+    ///
+    void Reserve(std::size_t count) noexcept;
+
+public:
+    ///
+    /// \return How many entities exist.
+    ///
+    LEPONG_NODISCARD std::size_t Size() const noexcept
+    {
+        return mNextEntity - mFreeEntities.size();
+    }
+
+    ///
+    /// \return Whether the entity was created and not destroyed since.
+    ///
+    LEPONG_NODISCARD bool IsAlive(Entity entity) const noexcept
+    {
+        return entity < mAlive.size() && mAlive[entity] != 0u;
+    }
+
+private:
+    Entity mNextEntity = 0;
+    std::vector<Entity> mFreeEntities;
+
+    // Indexed by entity.
+    std::vector<std::uint8_t> mAlive;
+};
+
+} // namespace lepong::Ecs
@@ -0,0 +1,27 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Math/Vector2.h"
+
+#include "Registry.h"
+
+namespace lepong::Ecs
+{
+
+// Systems go through the dense array of one pool and look the other components up. When the entities got their
+// components in the same order, which is the usual case, the lookups walk the other pools in order too.
+
+///
+/// Moves every entity with a velocity and a transform, like <i>GameObject::Update</i>.
+///
+void Integrate(Registry& registry, float delta) noexcept;
+
+///
+/// Bounces circles off the top and bottom of the arena, like <i>Ball::CollideWithTerrain</i>.
+///
+void BounceCirclesOffTerrain(Registry& registry, const Vector2i& arenaSize) noexcept;
+
+} // namespace lepong::Ecs
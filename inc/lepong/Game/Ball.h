@@ -4,9 +4,6 @@
 
 #pragma once
 
-#include "lepong/Graphics/GL.h"
-#include "lepong/Graphics/Mesh.h"
-
 #include "GameObject.h"
 #include "Paddle.h"
 
@@ -29,10 +26,7 @@ public:
     float radius;
 
 public:
-    Ball(float radius, Graphics::Mesh& mesh, GLuint& program) noexcept;
-
-public:
-    void Render() const noexcept;
+    explicit Ball(float radius) noexcept;
 
 public:
     void CollideWithTerrain(const Vector2i& winSize) noexcept;
@@ -42,6 +36,30 @@ public:
     ///
     LEPONG_NODISCARD bool CollideWith(const Paddle& paddle) noexcept;
 
+    ///
+    /// Changes the ball's direction and speed after hitting the paddle.
+    ///
+    void OnPaddleCollision(const Paddle& paddle) noexcept;
+
+public:
+    // Continuous collision. Instead of checking for overlaps after moving, these find when the ball touches
+    // something while moving by <i>motion</i>. They follow the same rules as their overlap counterparts.
+
+    ///
+    /// \return The fraction of the motion after which the ball touches the top or bottom of the terrain.<br>
+    /// If it doesn't during the motion, the return value is greater than 1.
+    ///
+    LEPONG_NODISCARD float GetTerrainImpactTime(const Vector2f& motion, const Vector2i& winSize) const noexcept;
+
+    ///
+    /// Sweeps the ball against the paddle, which moves by <i>paddleMotion</i> at the same time.<br>
+    /// Only hits on the front of the paddle while moving toward it count, like with <i>CollideWith</i>.
+    ///
+    /// \return Whether the ball hits the paddle, in which case <i>time</i> is the fraction of the motion before it does.
+    ///
+    LEPONG_NODISCARD bool SweepAgainst(
+        const Paddle& paddle, const Vector2f& motion, const Vector2f& paddleMotion, float& time) const noexcept;
+
 public:
     ///
     /// \return The side the ball is touching.<br>
@@ -55,19 +73,9 @@ public:
     ///
     void Reset(const Vector2i& winSize) noexcept;
 
-private:
-    Graphics::Mesh& mMesh;
-    GLuint& mProgram;
-
 private:
     LEPONG_NODISCARD bool IsBehind(const Paddle& paddle) const noexcept;
     bool DoCollideWith(const Paddle& paddle) noexcept;
-    void OnPaddleCollision(const Paddle& paddle) noexcept;
 };
 
-///
-/// A fragment shader that renders a circle. This shader requires texture data.
-///
-LEPONG_NODISCARD GLuint MakeBallFragmentShader() noexcept;
-
 } // namespace lepong
@@ -0,0 +1,23 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Attribute.h"
+
+#include "Ball.h"
+#include "Paddle.h"
+
+namespace lepong
+{
+
+///
+/// The simplest bot there is: moves the paddle toward the ball's height.<br>
+/// The paddle stays still while the ball is within <i>deadZone</i> pixels of its center.
+///
+/// \return The action the paddle should take this tick.
+///
+LEPONG_NODISCARD PaddleAction TrackBall(const Paddle& paddle, const Ball& ball, float deadZone = 10.0f) noexcept;
+
+} // namespace lepong
@@ -0,0 +1,132 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "lepong/Attribute.h"
+#include "lepong/Math/Vector2.h"
+
+namespace lepong
+{
+
+enum class ContactType : std::uint8_t
+{
+    // The ball bounced off the top or bottom of the terrain.
+    Wall,
+
+    // The ball bounced off a paddle.
+    Paddle,
+
+    // The ball reached a side and the point is over.
+    Side
+};
+
+///
+/// Something the ball touched during a tick.
+///
+struct Contact
+{
+    // The tick set by ContactBuffer::BeginTick.
+    std::uint64_t tick = 0;
+
+    // When during the tick the ball touched, from 0 at its start to 1 at its end. Without continuous collision,
+    // contacts are found after the ball overlaps, the time is found by moving the ball back.
+    float time = 0.0f;
+
+    ContactType type = ContactType::Wall;
+
+    // The paddle hit or the player whose side was reached, 0 or 1. 0 for walls.
+    std::uint8_t player = 0;
+
+    // Where the ball touched, on its edge.
+    Vector2f point;
+
+    // Points away from what the ball touched.
+    Vector2f normal;
+
+    float speedBefore = 0.0f;
+
+    // 0 for sides since the match is reset.
+    float speedAfter = 0.0f;
+};
+
+///
+/// Where a match writes its contacts, see <i>Match::contacts</i>.<br><br>
+///
+/// The storage is allocated once. A tick typically has at most a few contacts so a small capacity is enough,
+/// contacts past the capacity are counted then dropped.
+///
+class ContactBuffer
+{
+public:
+    explicit ContactBuffer(std::size_t capacity = 64) noexcept
+        : mContacts(std::make_unique<Contact[]>(capacity))
+        , mCapacity(capacity)
+    {
+    }
+
+public:
+    ///
+    /// Drops the contacts of the previous tick and stamps the next ones with <i>tick</i>.
+    ///
+    void BeginTick(std::uint64_t tick) noexcept
+    {
+        mTick = tick;
+        mSize = 0;
+        mDropped = 0;
+    }
+
+    ///
+    /// Only called by the simulation, fills the tick of the contact.
+    ///
+    void Push(const Contact& contact) noexcept
+    {
+        if (mSize == mCapacity)
+        {
+            ++mDropped;
+            return;
+        }
+
+        mContacts[mSize] = contact;
+        mContacts[mSize++].tick = mTick;
+    }
+
+public:
+    LEPONG_NODISCARD const Contact* begin() const noexcept
+    {
+        return mContacts.get();
+    }
+
+    LEPONG_NODISCARD const Contact* end() const noexcept
+    {
+        return mContacts.get() + mSize;
+    }
+
+    LEPONG_NODISCARD std::size_t Size() const noexcept
+    {
+        return mSize;
+    }
+
+    ///
+    /// \return How many contacts didn't fit since <i>BeginTick</i>.
+    ///
+    LEPONG_NODISCARD std::size_t GetDroppedCount() const noexcept
+    {
+        return mDropped;
+    }
+
+private:
+    std::unique_ptr<Contact[]> mContacts;
+    std::size_t mCapacity;
+
+    std::size_t mSize = 0;
+    std::size_t mDropped = 0;
+    std::uint64_t mTick = 0;
+};
+
+} // namespace lepong
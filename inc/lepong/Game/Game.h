@@ -5,5 +5,7 @@
 #pragma once
 
 #include "Ball.h"
+#include "Bot.h"
 #include "GameObject.h"
+#include "Match.h"
 #include "Paddle.h"
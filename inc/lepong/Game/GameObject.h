@@ -4,11 +4,25 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+
+#include "lepong/Attribute.h"
+#include "lepong/Math/Random.h"
 #include "lepong/Math/Vector2.h"
 
 namespace lepong
 {
 
+///
+/// The motion shared by the ball and the paddles. Not polymorphic: objects are always used through their own type and
+/// large numbers of entities go through the <i>Ecs</i> registry instead.<br><br>
+///
+/// The object keeps a hash of its motion up to date as it changes, so that hashing a match every tick doesn't read
+/// every field again. The hash is the XOR of one mixed value per field, changing a field only replaces its value.
+/// Update, the setters and the collision handlers maintain it, code writing the fields directly must call
+/// <i>Rehash</i> afterwards.
+///
 class GameObject
 {
 public:
@@ -17,8 +31,62 @@ public:
     float moveSpeed = 0;
     Vector2f moveDirection;
 
+    // See the class description, the default is the hash of the default motion.
+    std::uint64_t stateHash = HashField(0u, 0.0f) ^ HashField(1u, 0.0f) ^ HashField(2u, 0.0f) ^ HashField(3u, 0.0f) ^ HashField(4u, 0.0f);
+
 public:
-    virtual void Update(float delta) noexcept;
+    void Update(float delta) noexcept;
+
+public:
+    void SetPosition(const Vector2f& value) noexcept
+    {
+        stateHash ^= HashField(0u, position.x) ^ HashField(0u, value.x) ^ HashField(1u, position.y) ^ HashField(1u, value.y);
+        position = value;
+    }
+
+    void SetMoveSpeed(float value) noexcept
+    {
+        stateHash ^= HashField(2u, moveSpeed) ^ HashField(2u, value);
+        moveSpeed = value;
+    }
+
+    void SetMoveDirection(const Vector2f& value) noexcept
+    {
+        stateHash ^= HashField(3u, moveDirection.x) ^ HashField(3u, value.x) ^ HashField(4u, moveDirection.y) ^ HashField(4u, value.y);
+        moveDirection = value;
+    }
+
+    ///
+    /// Computes the hash of the motion from scratch, after the fields were written directly.
+    ///
+    void Rehash() noexcept
+    {
+        stateHash = ComputeStateHash();
+    }
+
+    ///
+    /// \return What <i>stateHash</i> should be, to check that it is up to date.
+    ///
+    LEPONG_NODISCARD std::uint64_t ComputeStateHash() const noexcept
+    {
+        return
+            HashField(0u, position.x) ^ HashField(1u, position.y) ^
+            HashField(2u, moveSpeed) ^
+            HashField(3u, moveDirection.x) ^ HashField(4u, moveDirection.y);
+    }
+
+private:
+    ///
+    /// \return The mixed field index and bits of the value. The mix is a bijection so two fields or two values never
+    /// give the same result.
+    ///
+    LEPONG_NODISCARD static std::uint64_t HashField(unsigned field, float value) noexcept
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        return Random::Mix((static_cast<std::uint64_t>(field) << 32u) | bits);
+    }
 };
 
 } // namespace lepong
@@ -0,0 +1,203 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Math/Random.h"
+
+#include "Ball.h"
+#include "Contact.h"
+#include "Paddle.h"
+
+namespace lepong
+{
+
+///
+/// Everything needed to simulate a game of Pong: the ball, both paddles and the scores.<br>
+/// This doesn't depend on any platform system so it can be simulated without a window.
+///
+class Match
+{
+public:
+    // Hardcoded but this should be fine on most monitors (maybe a bit small for 2k+).
+    static constexpr Vector2i skArenaSize = { 1280, 720 };
+
+    static constexpr float skBallRadius = 20.0f;
+
+    static constexpr Vector2f skPaddleSize = { 25.0f, 150.0f };
+    static constexpr float skPaddleBorderOffset = 50.0f;
+
+    // With continuous collision, a tick is split into substeps so that the ball moves at most this far in one.
+    static constexpr float skMaxSubstepDistance = skBallRadius;
+    static constexpr unsigned skMaxSubsteps = 16;
+
+    // The number of bounces handled in a single substep, the ball just moves on after that.
+    static constexpr unsigned skMaxContactsPerSubstep = 4;
+
+public:
+    Ball ball{ skBallRadius };
+
+    Paddle paddle1{ skPaddleSize,  1.0f };
+    Paddle paddle2{ skPaddleSize, -1.0f };
+
+    unsigned scores[2] = { 0u, 0u };
+    bool playing = false;
+
+    // Launch directions come from here. Each match owns its generator so matches can be played in parallel.
+    Random random;
+
+    ///
+    /// Whether to find the exact time the ball touches the walls and the paddles during a tick instead of checking
+    /// for overlaps at the end of it. This keeps the ball from going through paddles with large deltas or speeds.<br>
+    /// Off by default since the batch kernels only implement the overlap checks.
+    ///
+    bool continuousCollision = false;
+
+    ///
+    /// When set, <i>Update</i> appends every contact of the ball to this buffer. Without a buffer, looking for
+    /// contacts costs a test per collision check. Copies of the match write to the same buffer.
+    ///
+    ContactBuffer* contacts = nullptr;
+
+public:
+    ///
+    /// Creates a match with the paddles positioned on the terrain and the ball waiting to be launched.
+    ///
+    Match() noexcept;
+
+public:
+    ///
+    /// Resets the ball and the paddles, the scores are kept.
+    ///
+    void Reset() noexcept;
+
+    ///
+    /// Starts playing and launches the ball in a random diagonal direction.<br>
+    /// If the match is already being played, this function does nothing.
+    ///
+    void Launch() noexcept;
+
+    ///
+    /// Advances the match by the provided delta.<br>
+    /// When a point is scored, the scores are updated and the match is reset.
+    ///
+    /// \return The side that lost the point during this update or <code>Side::None</code>.
+    ///
+    Side Update(float delta) noexcept;
+
+public:
+    ///
+    /// \param player The player index, 0 or 1.
+    ///
+    LEPONG_NODISCARD constexpr Paddle& GetPaddle(unsigned player) noexcept
+    {
+        return player ? paddle2 : paddle1;
+    }
+
+    LEPONG_NODISCARD constexpr const Paddle& GetPaddle(unsigned player) const noexcept
+    {
+        return player ? paddle2 : paddle1;
+    }
+
+public:
+    ///
+    /// \return A hash of the state of the match, made from the hashes the ball and the paddles keep up to date and the
+    /// few other fields, so it costs the same whatever changed. Two matches with the same hash play the same from now
+    /// on, which is what desync checks compare every tick.
+    ///
+    LEPONG_NODISCARD std::uint64_t GetStateHash() const noexcept
+    {
+        return CombineStateHash(ball.stateHash, paddle1.stateHash, paddle2.stateHash);
+    }
+
+    ///
+    /// \return The hash <i>GetStateHash</i> should return, computed from every field.
+    ///
+    LEPONG_NODISCARD std::uint64_t ComputeStateHash() const noexcept
+    {
+        return CombineStateHash(ball.ComputeStateHash(), paddle1.ComputeStateHash(), paddle2.ComputeStateHash());
+    }
+
+    ///
+    /// Brings the hashes of the ball and the paddles up to date after their fields were written directly.
+    ///
+    void Rehash() noexcept
+    {
+        ball.Rehash();
+        paddle1.Rehash();
+        paddle2.Rehash();
+    }
+
+private:
+    LEPONG_NODISCARD std::uint64_t CombineStateHash(std::uint64_t ballHash, std::uint64_t paddle1Hash, std::uint64_t paddle2Hash) const noexcept
+    {
+        const auto kScores = static_cast<std::uint64_t>(scores[0]) | (static_cast<std::uint64_t>(scores[1]) << 32u);
+        const auto kFlags = (playing ? 1ull : 0ull) | (continuousCollision ? 2ull : 0ull);
+
+        // Every part gets its own mix so that swapping two parts changes the hash. The mixes don't depend on each
+        // other and run in parallel.
+        return
+            Random::Mix(ballHash + 1ull) ^
+            Random::Mix(paddle1Hash + 2ull) ^
+            Random::Mix(paddle2Hash + 3ull) ^
+            Random::Mix(random.state + 4ull) ^
+            Random::Mix(kScores ^ (kFlags << 62u));
+    }
+
+    void PositionPaddlesOnTerrain() noexcept;
+
+    ///
+    /// \param motion How far the ball moved in a straight line before this check, to time the contact.
+    /// \param fraction The part of the substep <i>motion</i> covers, see <i>PushOverlapContact</i>.
+    ///
+    void CheckBallSideCollision(Side& lostSide, const Vector2f& motion, float fraction) noexcept;
+
+    ///
+    /// Checks the ball against the terrain then the paddles, the second paddle only if the first one didn't
+    /// collide.
+    ///
+    /// \param motion How far the ball moved in a straight line before this check, to time the contacts.
+    /// \param fraction The part of the substep <i>motion</i> covers, see <i>PushOverlapContact</i>.
+    ///
+    /// \return Whether the ball collided with a paddle.
+    ///
+    bool CollideBall(const Vector2f& motion, float fraction) noexcept;
+
+    ///
+    /// Appends a contact found because the ball overlaps something after moving by <i>motion</i>. The contact is
+    /// timed by moving the ball back along <i>motion</i> until it only touches.
+    ///
+    /// \param penetration How far past the contact the ball is along <i>normal</i>.
+    /// \param fraction The part of the substep <i>motion</i> covers, ending at the end of the substep. 1 for discrete
+    /// updates, less after the sweeps of a continuous one.
+    ///
+    void PushOverlapContact(
+        ContactType type, unsigned player, const Vector2f& normal, float penetration, const Vector2f& motion, float fraction,
+        float speedBefore) noexcept;
+
+    ///
+    /// Appends a contact with the ball where it is now.
+    ///
+    /// \param time The part of the current substep the ball moved before the contact.
+    ///
+    void PushContact(ContactType type, unsigned player, const Vector2f& normal, float time, float speedBefore) noexcept;
+
+    Side UpdateDiscrete(float delta) noexcept;
+    Side UpdateContinuous(float delta) noexcept;
+    Side UpdateContinuousSubstep(float delta) noexcept;
+
+    ///
+    /// Moves the ball until its first contact with a wall or a paddle and handles the contact.
+    ///
+    /// \return Whether there was a contact, in which case <i>remaining</i> is reduced by the time it took.
+    ///
+    bool SweepBall(float delta, const Vector2f (&paddleStarts)[2], float& remaining, bool& hitPaddle) noexcept;
+
+private:
+    // The part of the tick the substep being simulated covers, to time contacts.
+    float mSubstepBegin = 0.0f;
+    float mSubstepLength = 1.0f;
+};
+
+} // namespace lepong
@@ -4,14 +4,22 @@
 
 #pragma once
 
-#include "lepong/Graphics/GL.h"
-#include "lepong/Graphics/Mesh.h"
-
 #include "GameObject.h"
 
 namespace lepong
 {
 
+///
+/// What a paddle is asked to do during a tick.<br>
+/// This is what the keyboard handlers and the bots both boil down to.
+///
+enum class PaddleAction
+{
+    Stay = 0,
+    Up   = 1,
+    Down = 2
+};
+
 class Paddle : public GameObject
 {
 public:
@@ -24,11 +32,10 @@ public:
     float forward;
 
 public:
-    Paddle(const Vector2f& size, float forward, Graphics::Mesh& mesh, GLuint& program) noexcept;
+    Paddle(const Vector2f& size, float forward) noexcept;
 
 public:
     void Update(float delta, const Vector2i& winSize) noexcept;
-    void Render() const noexcept;
 
 public:
     ///
@@ -42,17 +49,13 @@ public:
     void OnMoveUpReleased() noexcept;
     void OnMoveDownReleased() noexcept;
 
-private:
-    Graphics::Mesh& mMesh;
-    GLuint& mProgram;
+    ///
+    /// Translates the action into the corresponding pressed/released calls.
+    ///
+    void ApplyAction(PaddleAction action) noexcept;
 
 private:
     void CollideWithTerrain(const Vector2i& winSize, const Vector2f& preUpdatePosition) noexcept;
 };
 
-///
-/// A basic fragment shader that outputs white.
-///
-LEPONG_NODISCARD GLuint MakePaddleFragmentShader() noexcept;
-
 } // namespace lepong
@@ -0,0 +1,39 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Graphics/GL.h"
+#include "lepong/Graphics/Mesh.h"
+
+#include "Ball.h"
+#include "Paddle.h"
+
+namespace lepong
+{
+
+// The game objects only hold simulation data, drawing them is done here so that the simulation
+// can be built without a window or an OpenGL context.
+
+///
+/// Draws the ball using a textured quad and a program made with <i>MakeBallFragmentShader</i>.
+///
+void RenderBall(const Ball& ball, const Graphics::Mesh& texturedQuad, GLuint program) noexcept;
+
+///
+/// Draws the paddle using a simple quad and a program made with <i>MakePaddleFragmentShader</i>.
+///
+void RenderPaddle(const Paddle& paddle, const Graphics::Mesh& quad, GLuint program) noexcept;
+
+///
+/// A fragment shader that renders a circle. This shader requires texture data.
+///
+LEPONG_NODISCARD GLuint MakeBallFragmentShader() noexcept;
+
+///
+/// A basic fragment shader that outputs white.
+///
+LEPONG_NODISCARD GLuint MakePaddleFragmentShader() noexcept;
+
+} // namespace lepong
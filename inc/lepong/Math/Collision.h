@@ -0,0 +1,39 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Attribute.h"
+
+#include "Vector2.h"
+
+namespace lepong
+{
+
+///
+/// The first contact found by a sweep test.
+///
+struct SweepHit
+{
+    // The fraction of the motion done before touching, in [0, 1].
+    float time = 1.0f;
+
+    // Points from the obstacle toward the moving circle.
+    Vector2f normal;
+};
+
+///
+/// Sweeps a circle along <i>motion</i> against an axis aligned box.<br>
+/// If the box is also moving, pass the circle's motion relative to the box.<br><br>
+///
+/// The test is exact: the circle hits the box when its center enters the box grown by the radius with rounded
+/// corners. A circle that already overlaps the box at the start of the motion is not considered to hit it.
+///
+/// \return Whether the circle touches the box during the motion, in which case <i>hit</i> is set.
+///
+LEPONG_NODISCARD bool SweepCircleAabb(
+    const Vector2f& center, float radius, const Vector2f& motion,
+    const Vector2f& boxCenter, const Vector2f& boxHalfSize, SweepHit& hit) noexcept;
+
+} // namespace lepong
@@ -0,0 +1,152 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+#include "Vector2.h"
+
+namespace lepong
+{
+
+///
+/// A Q16.16 fixed point number: 16 integer bits, sign included, and 16 fraction bits.<br><br>
+///
+/// Every operation is done on integers so the results are the same on every compiler, optimization level and CPU.
+/// Multiplications and divisions round toward negative infinity. Values must stay within [-32768, 32768), there is
+/// no overflow check.
+///
+class Fixed
+{
+public:
+    static constexpr int skFractionBits = 16;
+    static constexpr std::int32_t skOne = std::int32_t{ 1 } << skFractionBits;
+
+public:
+    constexpr Fixed() noexcept = default;
+
+    // Implicit so that integer literals work like they do with floats.
+    constexpr Fixed(int value) noexcept // NOLINT
+        : mRaw(value * skOne)
+    {
+    }
+
+    ///
+    /// Rounds to the nearest representable value. Only meant for constants and inputs, not for the simulation.
+    ///
+    explicit constexpr Fixed(float value) noexcept
+        : mRaw(static_cast<std::int32_t>(value * static_cast<float>(skOne) + (value < 0.0f ? -0.5f : 0.5f)))
+    {
+    }
+
+    LEPONG_NODISCARD static constexpr Fixed FromRaw(std::int32_t raw) noexcept
+    {
+        Fixed result;
+        result.mRaw = raw;
+
+        return result;
+    }
+
+public:
+    LEPONG_NODISCARD constexpr std::int32_t Raw() const noexcept
+    {
+        return mRaw;
+    }
+
+    LEPONG_NODISCARD explicit constexpr operator float() const noexcept
+    {
+        return static_cast<float>(mRaw) / static_cast<float>(skOne);
+    }
+
+public:
+    constexpr Fixed& operator+=(Fixed other) noexcept
+    {
+        mRaw += other.mRaw;
+        return *this;
+    }
+
+    constexpr Fixed& operator-=(Fixed other) noexcept
+    {
+        mRaw -= other.mRaw;
+        return *this;
+    }
+
+    constexpr Fixed& operator*=(Fixed other) noexcept
+    {
+        return *this = *this * other;
+    }
+
+    constexpr Fixed& operator/=(Fixed other) noexcept
+    {
+        return *this = *this / other;
+    }
+
+    LEPONG_NODISCARD constexpr Fixed operator-() const noexcept
+    {
+        return FromRaw(-mRaw);
+    }
+
+    LEPONG_NODISCARD constexpr Fixed operator+(Fixed other) const noexcept
+    {
+        return FromRaw(mRaw + other.mRaw);
+    }
+
+    LEPONG_NODISCARD constexpr Fixed operator-(Fixed other) const noexcept
+    {
+        return FromRaw(mRaw - other.mRaw);
+    }
+
+    LEPONG_NODISCARD constexpr Fixed operator*(Fixed other) const noexcept
+    {
+        const auto kProduct = static_cast<std::int64_t>(mRaw) * other.mRaw;
+
+        // Dividing would round toward zero, the shift is arithmetic on every supported compiler.
+        return FromRaw(static_cast<std::int32_t>(kProduct >> skFractionBits));
+    }
+
+    LEPONG_NODISCARD constexpr Fixed operator/(Fixed other) const noexcept
+    {
+        const auto kNumerator = static_cast<std::int64_t>(mRaw) * skOne;
+        return FromRaw(static_cast<std::int32_t>(kNumerator / other.mRaw));
+    }
+
+public:
+    LEPONG_NODISCARD constexpr bool operator==(Fixed other) const noexcept { return mRaw == other.mRaw; }
+    LEPONG_NODISCARD constexpr bool operator!=(Fixed other) const noexcept { return mRaw != other.mRaw; }
+    LEPONG_NODISCARD constexpr bool operator<(Fixed other) const noexcept { return mRaw < other.mRaw; }
+    LEPONG_NODISCARD constexpr bool operator>(Fixed other) const noexcept { return mRaw > other.mRaw; }
+    LEPONG_NODISCARD constexpr bool operator<=(Fixed other) const noexcept { return mRaw <= other.mRaw; }
+    LEPONG_NODISCARD constexpr bool operator>=(Fixed other) const noexcept { return mRaw >= other.mRaw; }
+
+private:
+    std::int32_t mRaw = 0;
+};
+
+template<>
+struct IsScalar<Fixed> : std::true_type
+{
+};
+
+using Vector2x = Vector2<Fixed>;
+
+LEPONG_NODISCARD constexpr Fixed Abs(Fixed value) noexcept
+{
+    return value < 0 ? -value : value;
+}
+
+///
+/// \return The square root of <i>value</i> rounded down, computed with integers only. Negative values give 0.
+///
+LEPONG_NODISCARD Fixed Sqrt(Fixed value) noexcept;
+
+///
+/// \return <code>Sqrt(x * x + y * y)</code> rounded down. The squares are kept in 64 bits so this doesn't overflow
+/// for any pair of coordinates in the arena.
+///
+LEPONG_NODISCARD Fixed Hypot(Fixed x, Fixed y) noexcept;
+
+} // namespace lepong
@@ -0,0 +1,372 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+namespace lepong
+{
+
+///
+/// A small random number generator (SplitMix64) whose whole state is one integer, so that every match can own one
+/// and give the same results no matter which thread plays it.<br>
+/// The generators below have longer periods, cheap jumps ahead or no state at all for the code that needs them.
+///
+class Random
+{
+public:
+    std::uint64_t state = 0;
+
+public:
+    constexpr Random() noexcept = default;
+
+    constexpr explicit Random(std::uint64_t seed) noexcept
+        : state(seed)
+    {
+    }
+
+    ///
+    /// Creates the generator of stream <i>stream</i> for a seed, e.g. the generator of a match from its index.
+    /// Close seeds and streams give unrelated sequences.
+    ///
+    constexpr Random(std::uint64_t seed, std::uint64_t stream) noexcept
+        : state(Mix(seed ^ Mix(stream + skIncrement)))
+    {
+    }
+
+public:
+    LEPONG_NODISCARD constexpr std::uint64_t Next() noexcept
+    {
+        state += skIncrement;
+        return Mix(state);
+    }
+
+    ///
+    /// \return A float in [0, 1) with 24 random bits.
+    ///
+    LEPONG_NODISCARD constexpr float NextFloat() noexcept
+    {
+        return static_cast<float>(Next() >> 40u) * (1.0f / 16777216.0f);
+    }
+
+    ///
+    /// \return Randomly <code>1</code> or <code>-1</code>.
+    ///
+    LEPONG_NODISCARD constexpr int NextSign() noexcept
+    {
+        return (Next() >> 63u) ? 1 : -1;
+    }
+
+    ///
+    /// \return Randomly <code>1.0f</code> or <code>-1.0f</code>.
+    ///
+    LEPONG_NODISCARD constexpr float NextSignFloat() noexcept
+    {
+        return static_cast<float>(NextSign());
+    }
+
+public:
+    ///
+    /// The SplitMix64 finalizer, a bijection that spreads every bit of the value over the whole result. Also used to
+    /// hash states.
+    ///
+    LEPONG_NODISCARD static constexpr std::uint64_t Mix(std::uint64_t value) noexcept
+    {
+        value = (value ^ (value >> 30u)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27u)) * 0x94D049BB133111EBull;
+
+        return value ^ (value >> 31u);
+    }
+
+private:
+    static constexpr std::uint64_t skIncrement = 0x9E3779B97F4A7C15ull;
+};
+
+///
+/// PCG32 (XSH RR): 32 bit outputs from a 64 bit LCG state. Each odd increment is an independent stream, and the
+/// generator can jump ahead by any number of steps in logarithmic time.
+///
+class Pcg32
+{
+public:
+    std::uint64_t state = 0;
+    std::uint64_t increment = 1;
+
+public:
+    constexpr Pcg32() noexcept = default;
+
+    constexpr explicit Pcg32(std::uint64_t seed, std::uint64_t stream = 0) noexcept
+        : increment((stream << 1u) | 1u)
+    {
+        // The seeding sequence of the reference implementation.
+        static_cast<void>(Next());
+        state += seed;
+        static_cast<void>(Next());
+    }
+
+public:
+    LEPONG_NODISCARD constexpr std::uint32_t Next() noexcept
+    {
+        const auto kOld = state;
+        state = kOld * skMultiplier + increment;
+
+        const auto kXorShifted = static_cast<std::uint32_t>(((kOld >> 18u) ^ kOld) >> 27u);
+        const auto kRotation = static_cast<std::uint32_t>(kOld >> 59u);
+
+        return (kXorShifted >> kRotation) | (kXorShifted << ((32u - kRotation) & 31u));
+    }
+
+    ///
+    /// \return A float in [0, 1) with 24 random bits.
+    ///
+    LEPONG_NODISCARD constexpr float NextFloat() noexcept
+    {
+        return static_cast<float>(Next() >> 8u) * (1.0f / 16777216.0f);
+    }
+
+    ///
+    /// Skips <i>steps</i> outputs, as if <i>Next</i> was called that many times.
+    ///
+    constexpr void Advance(std::uint64_t steps) noexcept
+    {
+        // Composes the LCG with itself by squaring, see Brown, "Random Number Generation with Arbitrary Strides".
+        std::uint64_t multiplier = skMultiplier;
+        std::uint64_t addend = increment;
+        std::uint64_t totalMultiplier = 1;
+        std::uint64_t totalAddend = 0;
+
+        for (; steps; steps >>= 1u)
+        {
+            if (steps & 1u)
+            {
+                totalMultiplier *= multiplier;
+                totalAddend = totalAddend * multiplier + addend;
+            }
+
+            addend = (multiplier + 1) * addend;
+            multiplier *= multiplier;
+        }
+
+        state = totalMultiplier * state + totalAddend;
+    }
+
+private:
+    static constexpr std::uint64_t skMultiplier = 6364136223846793005ull;
+};
+
+///
+/// xoshiro256**: fast 64 bit outputs with a 256 bit state. <i>Jump</i> moves 2^128 outputs ahead, so generators
+/// split off with it never overlap, e.g. one per thread.
+///
+class Xoshiro256
+{
+public:
+    std::uint64_t state[4] = {};
+
+public:
+    constexpr Xoshiro256() noexcept = default;
+
+    ///
+    /// Fills the state from a SplitMix64 generator, as the authors recommend, so it can't be all zeros.
+    ///
+    constexpr explicit Xoshiro256(std::uint64_t seed) noexcept
+    {
+        Random seeder(seed);
+
+        for (auto& word : state)
+        {
+            word = seeder.Next();
+        }
+    }
+
+public:
+    LEPONG_NODISCARD constexpr std::uint64_t Next() noexcept
+    {
+        const auto kResult = RotateLeft(state[1] * 5u, 7u) * 9u;
+        const auto kShifted = state[1] << 17u;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= kShifted;
+        state[3] = RotateLeft(state[3], 45u);
+
+        return kResult;
+    }
+
+    ///
+    /// \return A float in [0, 1) with 24 random bits.
+    ///
+    LEPONG_NODISCARD constexpr float NextFloat() noexcept
+    {
+        return static_cast<float>(Next() >> 40u) * (1.0f / 16777216.0f);
+    }
+
+    ///
+    /// Moves 2^128 outputs ahead.
+    ///
+    constexpr void Jump() noexcept
+    {
+        constexpr std::uint64_t kJump[] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+        Polynomial(kJump);
+    }
+
+    ///
+    /// Moves 2^192 outputs ahead.
+    ///
+    constexpr void LongJump() noexcept
+    {
+        constexpr std::uint64_t kLongJump[] = { 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+        Polynomial(kLongJump);
+    }
+
+private:
+    LEPONG_NODISCARD static constexpr std::uint64_t RotateLeft(std::uint64_t value, unsigned count) noexcept
+    {
+        return (value << count) | (value >> (64u - count));
+    }
+
+    constexpr void Polynomial(const std::uint64_t (&polynomial)[4]) noexcept
+    {
+        std::uint64_t jumped[4] = {};
+
+        for (const auto kWord : polynomial)
+        {
+            for (auto bit = 0u; bit < 64u; ++bit)
+            {
+                if (kWord & (std::uint64_t{ 1 } << bit))
+                {
+                    for (auto i = 0; i < 4; ++i)
+                    {
+                        jumped[i] ^= state[i];
+                    }
+                }
+
+                static_cast<void>(Next());
+            }
+        }
+
+        for (auto i = 0; i < 4; ++i)
+        {
+            state[i] = jumped[i];
+        }
+    }
+};
+
+///
+/// Philox4x32-10, a counter-based generator: output block n of a stream is a hash of (n, stream) under a key made
+/// from the seed. There is no state to carry around, any block of any stream can be computed directly, so jumping
+/// ahead is free and results don't depend on which thread or lane asks for them in which order.<br><br>
+///
+/// Each block is 4 independent 32 bit outputs.
+///
+class Philox4x32
+{
+public:
+    struct Block
+    {
+        std::uint32_t values[4];
+    };
+
+public:
+    std::uint32_t key[2] = {};
+    std::uint64_t stream = 0;
+
+    // The next block.
+    std::uint64_t counter = 0;
+
+public:
+    constexpr Philox4x32() noexcept = default;
+
+    constexpr explicit Philox4x32(std::uint64_t seed, std::uint64_t stream = 0) noexcept
+        : key{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32u) }
+        , stream(stream)
+    {
+    }
+
+public:
+    ///
+    /// \return Block <i>counter</i> of stream <i>stream</i>.
+    ///
+    LEPONG_NODISCARD static constexpr Block Generate(
+        std::uint64_t counter, std::uint64_t stream, const std::uint32_t (&key)[2]) noexcept
+    {
+        std::uint32_t c[] =
+        {
+            static_cast<std::uint32_t>(counter),
+            static_cast<std::uint32_t>(counter >> 32u),
+            static_cast<std::uint32_t>(stream),
+            static_cast<std::uint32_t>(stream >> 32u)
+        };
+
+        std::uint32_t k[] = { key[0], key[1] };
+
+        for (auto round = 0; round < 10; ++round)
+        {
+            const auto kProduct0 = static_cast<std::uint64_t>(skMultiplier0) * c[0];
+            const auto kProduct1 = static_cast<std::uint64_t>(skMultiplier1) * c[2];
+
+            const std::uint32_t kNext[] =
+            {
+                static_cast<std::uint32_t>(kProduct1 >> 32u) ^ c[1] ^ k[0],
+                static_cast<std::uint32_t>(kProduct1),
+                static_cast<std::uint32_t>(kProduct0 >> 32u) ^ c[3] ^ k[1],
+                static_cast<std::uint32_t>(kProduct0)
+            };
+
+            for (auto i = 0; i < 4; ++i)
+            {
+                c[i] = kNext[i];
+            }
+
+            k[0] += skWeyl0;
+            k[1] += skWeyl1;
+        }
+
+        return { { c[0], c[1], c[2], c[3] } };
+    }
+
+    LEPONG_NODISCARD constexpr Block NextBlock() noexcept
+    {
+        return Generate(counter++, stream, key);
+    }
+
+    ///
+    /// Skips <i>blocks</i> blocks.
+    ///
+    constexpr void Advance(std::uint64_t blocks) noexcept
+    {
+        counter += blocks;
+    }
+
+public:
+    ///
+    /// Fills <i>values</i> with the next outputs. Whole blocks are used, so a count that isn't a multiple of 4
+    /// wastes the rest of the last block.
+    ///
+    void Fill(std::uint32_t* values, std::size_t count) noexcept;
+
+    ///
+    /// Same as <i>Fill</i> with floats in [0, 1) with 24 random bits.
+    ///
+    void FillFloats(float* values, std::size_t count) noexcept;
+
+    ///
+    /// Same as <i>Fill</i> with randomly <code>1.0f</code> or <code>-1.0f</code>.
+    ///
+    void FillSigns(float* values, std::size_t count) noexcept;
+
+private:
+    static constexpr std::uint32_t skMultiplier0 = 0xD2511F53u;
+    static constexpr std::uint32_t skMultiplier1 = 0xCD9E8D57u;
+    static constexpr std::uint32_t skWeyl0 = 0x9E3779B9u;
+    static constexpr std::uint32_t skWeyl1 = 0xBB67AE85u;
+};
+
+} // namespace lepong
@@ -12,14 +12,23 @@
 namespace lepong
 {
 
-template<typename Scalar, std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+///
+/// Whether a type can be used as the components of a Vector2. Number types other than the built-in ones specialize
+/// this.
+///
+template<typename T>
+struct IsScalar : std::is_arithmetic<T>
+{
+};
+
+template<typename Scalar, std::enable_if_t<IsScalar<Scalar>::value, int> = 0>
 struct Vector2
 {
     Scalar x = 0;
     Scalar y = 0;
 
 public:
-    constexpr Vector2 operator*=(Scalar s) const noexcept
+    constexpr Vector2& operator*=(Scalar s) noexcept
     {
         x *= s;
         y *= s;
@@ -27,7 +36,7 @@ public:
         return *this;
     }
 
-    constexpr Vector2 operator/=(Scalar s) const noexcept
+    constexpr Vector2& operator/=(Scalar s) noexcept
     {
         x /= s;
         y /= s;
@@ -89,4 +98,12 @@ LEPONG_NODISCARD constexpr Vector2f Normalize(const Vector2f& v) noexcept
     return v / v.Mag();
 }
 
+///
+/// \return <i>a</i> when <i>t</i> is 0, <i>b</i> when <i>t</i> is 1 and a linear interpolation in between.
+///
+LEPONG_NODISCARD constexpr Vector2f Lerp(const Vector2f& a, const Vector2f& b, float t) noexcept
+{
+    return a + (b - a) * t;
+}
+
 } // namespace lepong
@@ -0,0 +1,430 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cmath>
+
+#include "lepong/Attribute.h"
+
+#include "Vector2.h"
+
+// Packed vectors holding several Vector2f in registers, x components in one register and y components in another.
+//
+// The instruction set is picked when compiling: AVX for Float8 when the translation unit is built with it, SSE2 or
+// NEON for Float4, plain arrays otherwise. Defining LEPONG_SIMD_DISABLE forces the plain arrays.
+//
+// Everything below lives in an inline namespace named after the instruction set so that translation units built
+// for different instruction sets never share a definition. Otherwise the linker could pick an AVX version of a
+// function for code that must also run on CPUs without AVX.
+
+#if !defined(LEPONG_SIMD_DISABLE)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LEPONG_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define LEPONG_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(__AVX__)
+#define LEPONG_SIMD_AVX
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(LEPONG_SIMD_AVX)
+#define LEPONG_SIMD_NAMESPACE SimdAVX
+#elif defined(LEPONG_SIMD_SSE2)
+#define LEPONG_SIMD_NAMESPACE SimdSSE2
+#elif defined(LEPONG_SIMD_NEON)
+#define LEPONG_SIMD_NAMESPACE SimdNEON
+#else
+#define LEPONG_SIMD_NAMESPACE SimdScalar
+#endif
+
+namespace lepong
+{
+
+inline namespace LEPONG_SIMD_NAMESPACE
+{
+
+///
+/// The maximum relative error of <i>InverseSqrtFast</i>, whatever the instruction set.
+///
+static constexpr auto skInverseSqrtFastMaxError = 1e-5f;
+
+///
+/// Four floats.
+///
+struct Float4
+{
+#if defined(LEPONG_SIMD_SSE2)
+    __m128 v;
+#elif defined(LEPONG_SIMD_NEON)
+    float32x4_t v;
+#else
+    float v[4];
+#endif
+
+public:
+    static constexpr auto skWidth = 4;
+
+public:
+    LEPONG_NODISCARD static Float4 Broadcast(float s) noexcept
+    {
+#if defined(LEPONG_SIMD_SSE2)
+        return { _mm_set1_ps(s) };
+#elif defined(LEPONG_SIMD_NEON)
+        return { vdupq_n_f32(s) };
+#else
+        return { { s, s, s, s } };
+#endif
+    }
+
+    LEPONG_NODISCARD static Float4 Load(const float* p) noexcept
+    {
+#if defined(LEPONG_SIMD_SSE2)
+        return { _mm_loadu_ps(p) };
+#elif defined(LEPONG_SIMD_NEON)
+        return { vld1q_f32(p) };
+#else
+        return { { p[0], p[1], p[2], p[3] } };
+#endif
+    }
+
+    void Store(float* p) const noexcept
+    {
+#if defined(LEPONG_SIMD_SSE2)
+        _mm_storeu_ps(p, v);
+#elif defined(LEPONG_SIMD_NEON)
+        vst1q_f32(p, v);
+#else
+        for (auto i = 0; i < skWidth; ++i)
+        {
+            p[i] = v[i];
+        }
+#endif
+    }
+};
+
+#if defined(LEPONG_SIMD_SSE2)
+#define LEPONG_FLOAT4_OPERATOR(op, intrinsic)                                    \
+    LEPONG_NODISCARD inline Float4 operator op(Float4 a, Float4 b) noexcept     \
+    {                                                                            \
+        return { intrinsic(a.v, b.v) };                                          \
+    }
+LEPONG_FLOAT4_OPERATOR(+, _mm_add_ps)
+LEPONG_FLOAT4_OPERATOR(-, _mm_sub_ps)
+LEPONG_FLOAT4_OPERATOR(*, _mm_mul_ps)
+LEPONG_FLOAT4_OPERATOR(/, _mm_div_ps)
+#elif defined(LEPONG_SIMD_NEON)
+#define LEPONG_FLOAT4_OPERATOR(op, intrinsic)                                    \
+    LEPONG_NODISCARD inline Float4 operator op(Float4 a, Float4 b) noexcept     \
+    {                                                                            \
+        return { intrinsic(a.v, b.v) };                                          \
+    }
+LEPONG_FLOAT4_OPERATOR(+, vaddq_f32)
+LEPONG_FLOAT4_OPERATOR(-, vsubq_f32)
+LEPONG_FLOAT4_OPERATOR(*, vmulq_f32)
+LEPONG_FLOAT4_OPERATOR(/, vdivq_f32)
+#else
+#define LEPONG_FLOAT4_OPERATOR(op, unused)                                       \
+    LEPONG_NODISCARD inline Float4 operator op(Float4 a, Float4 b) noexcept     \
+    {                                                                            \
+        return { { a.v[0] op b.v[0], a.v[1] op b.v[1], a.v[2] op b.v[2], a.v[3] op b.v[3] } }; \
+    }
+LEPONG_FLOAT4_OPERATOR(+, _)
+LEPONG_FLOAT4_OPERATOR(-, _)
+LEPONG_FLOAT4_OPERATOR(*, _)
+LEPONG_FLOAT4_OPERATOR(/, _)
+#endif
+#undef LEPONG_FLOAT4_OPERATOR
+
+///
+/// Correctly rounded, same results as <i>sqrtf</i>.
+///
+LEPONG_NODISCARD inline Float4 Sqrt(Float4 a) noexcept
+{
+#if defined(LEPONG_SIMD_SSE2)
+    return { _mm_sqrt_ps(a.v) };
+#elif defined(LEPONG_SIMD_NEON)
+    return { vsqrtq_f32(a.v) };
+#else
+    return { { sqrtf(a.v[0]), sqrtf(a.v[1]), sqrtf(a.v[2]), sqrtf(a.v[3]) } };
+#endif
+}
+
+///
+/// An approximation of <code>1 / Sqrt(a)</code> within <i>skInverseSqrtFastMaxError</i>.
+///
+LEPONG_NODISCARD inline Float4 InverseSqrtFast(Float4 a) noexcept
+{
+#if defined(LEPONG_SIMD_SSE2)
+    // The estimate is good to about 12 bits, one Newton-Raphson step brings it to about 22.
+    const auto kEstimate = Float4{ _mm_rsqrt_ps(a.v) };
+    return kEstimate * (Float4::Broadcast(1.5f) - Float4::Broadcast(0.5f) * a * kEstimate * kEstimate);
+#elif defined(LEPONG_SIMD_NEON)
+    // The estimate is only good to about 8 bits, hence the two steps.
+    auto estimate = vrsqrteq_f32(a.v);
+    estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(a.v, estimate), estimate));
+    estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(a.v, estimate), estimate));
+    return { estimate };
+#else
+    return Float4::Broadcast(1.0f) / Sqrt(a);
+#endif
+}
+
+///
+/// Eight floats, two Float4 when not building for AVX.
+///
+struct Float8
+{
+#if defined(LEPONG_SIMD_AVX)
+    __m256 v;
+#else
+    Float4 v[2];
+#endif
+
+public:
+    static constexpr auto skWidth = 8;
+
+public:
+    LEPONG_NODISCARD static Float8 Broadcast(float s) noexcept
+    {
+#if defined(LEPONG_SIMD_AVX)
+        return { _mm256_set1_ps(s) };
+#else
+        return { { Float4::Broadcast(s), Float4::Broadcast(s) } };
+#endif
+    }
+
+    LEPONG_NODISCARD static Float8 Load(const float* p) noexcept
+    {
+#if defined(LEPONG_SIMD_AVX)
+        return { _mm256_loadu_ps(p) };
+#else
+        return { { Float4::Load(p), Float4::Load(p + 4) } };
+#endif
+    }
+
+    void Store(float* p) const noexcept
+    {
+#if defined(LEPONG_SIMD_AVX)
+        _mm256_storeu_ps(p, v);
+#else
+        v[0].Store(p);
+        v[1].Store(p + 4);
+#endif
+    }
+};
+
+#if defined(LEPONG_SIMD_AVX)
+#define LEPONG_FLOAT8_OPERATOR(op, intrinsic)                                    \
+    LEPONG_NODISCARD inline Float8 operator op(Float8 a, Float8 b) noexcept     \
+    {                                                                            \
+        return { intrinsic(a.v, b.v) };                                          \
+    }
+LEPONG_FLOAT8_OPERATOR(+, _mm256_add_ps)
+LEPONG_FLOAT8_OPERATOR(-, _mm256_sub_ps)
+LEPONG_FLOAT8_OPERATOR(*, _mm256_mul_ps)
+LEPONG_FLOAT8_OPERATOR(/, _mm256_div_ps)
+#else
+#define LEPONG_FLOAT8_OPERATOR(op, unused)                                       \
+    LEPONG_NODISCARD inline Float8 operator op(Float8 a, Float8 b) noexcept     \
+    {                                                                            \
+        return { { a.v[0] op b.v[0], a.v[1] op b.v[1] } };                       \
+    }
+LEPONG_FLOAT8_OPERATOR(+, _)
+LEPONG_FLOAT8_OPERATOR(-, _)
+LEPONG_FLOAT8_OPERATOR(*, _)
+LEPONG_FLOAT8_OPERATOR(/, _)
+#endif
+#undef LEPONG_FLOAT8_OPERATOR
+
+LEPONG_NODISCARD inline Float8 Sqrt(Float8 a) noexcept
+{
+#if defined(LEPONG_SIMD_AVX)
+    return { _mm256_sqrt_ps(a.v) };
+#else
+    return { { Sqrt(a.v[0]), Sqrt(a.v[1]) } };
+#endif
+}
+
+LEPONG_NODISCARD inline Float8 InverseSqrtFast(Float8 a) noexcept
+{
+#if defined(LEPONG_SIMD_AVX)
+    const auto kEstimate = Float8{ _mm256_rsqrt_ps(a.v) };
+    return kEstimate * (Float8::Broadcast(1.5f) - Float8::Broadcast(0.5f) * a * kEstimate * kEstimate);
+#else
+    return { { InverseSqrtFast(a.v[0]), InverseSqrtFast(a.v[1]) } };
+#endif
+}
+
+///
+/// <i>Lane::skWidth</i> vectors. The operations are done in the same order as their Vector2 counterparts so both
+/// give the same results, except for the <i>Fast</i> functions.
+///
+template<typename Lane>
+struct Vector2xN
+{
+    Lane x;
+    Lane y;
+
+public:
+    static constexpr auto skWidth = Lane::skWidth;
+
+public:
+    LEPONG_NODISCARD static Vector2xN Broadcast(const Vector2f& v) noexcept
+    {
+        return { Lane::Broadcast(v.x), Lane::Broadcast(v.y) };
+    }
+
+    ///
+    /// Loads <i>skWidth</i> consecutive vectors.
+    ///
+    LEPONG_NODISCARD static Vector2xN Load(const Vector2f* p) noexcept;
+
+    ///
+    /// Stores the vectors to <i>skWidth</i> consecutive vectors.
+    ///
+    void Store(Vector2f* p) const noexcept;
+
+public:
+    Vector2xN& operator+=(const Vector2xN& other) noexcept
+    {
+        x = x + other.x;
+        y = y + other.y;
+
+        return *this;
+    }
+
+    LEPONG_NODISCARD Vector2xN operator+(const Vector2xN& other) const noexcept
+    {
+        return { x + other.x, y + other.y };
+    }
+
+    LEPONG_NODISCARD Vector2xN operator-(const Vector2xN& other) const noexcept
+    {
+        return { x - other.x, y - other.y };
+    }
+
+    LEPONG_NODISCARD Vector2xN operator*(Lane s) const noexcept
+    {
+        return { x * s, y * s };
+    }
+
+    LEPONG_NODISCARD Vector2xN operator/(Lane s) const noexcept
+    {
+        return { x / s, y / s };
+    }
+
+public:
+    LEPONG_NODISCARD Lane SquareMag() const noexcept
+    {
+        return (x * x) + (y * y);
+    }
+
+    LEPONG_NODISCARD Lane Mag() const noexcept
+    {
+        return Sqrt(SquareMag());
+    }
+};
+
+using Vector2x4f = Vector2xN<Float4>;
+using Vector2x8f = Vector2xN<Float8>;
+
+template<typename Lane>
+LEPONG_NODISCARD inline Vector2xN<Lane> Normalize(const Vector2xN<Lane>& v) noexcept
+{
+    return v / v.Mag();
+}
+
+///
+/// Normalizes with <i>InverseSqrtFast</i>, the components are off by at most <i>skInverseSqrtFastMaxError</i>.
+///
+template<typename Lane>
+LEPONG_NODISCARD inline Vector2xN<Lane> NormalizeFast(const Vector2xN<Lane>& v) noexcept
+{
+    return v * InverseSqrtFast(v.SquareMag());
+}
+
+template<>
+inline Vector2x4f Vector2x4f::Load(const Vector2f* p) noexcept
+{
+#if defined(LEPONG_SIMD_SSE2)
+    const auto* kFloats = reinterpret_cast<const float*>(p);
+
+    const auto kLow = _mm_loadu_ps(kFloats);
+    const auto kHigh = _mm_loadu_ps(kFloats + 4);
+
+    return { { _mm_shuffle_ps(kLow, kHigh, _MM_SHUFFLE(2, 0, 2, 0)) }, { _mm_shuffle_ps(kLow, kHigh, _MM_SHUFFLE(3, 1, 3, 1)) } };
+#elif defined(LEPONG_SIMD_NEON)
+    const auto kPair = vld2q_f32(reinterpret_cast<const float*>(p));
+    return { { kPair.val[0] }, { kPair.val[1] } };
+#else
+    return { { { p[0].x, p[1].x, p[2].x, p[3].x } }, { { p[0].y, p[1].y, p[2].y, p[3].y } } };
+#endif
+}
+
+template<>
+inline void Vector2x4f::Store(Vector2f* p) const noexcept
+{
+#if defined(LEPONG_SIMD_SSE2)
+    auto* floats = reinterpret_cast<float*>(p);
+
+    _mm_storeu_ps(floats, _mm_unpacklo_ps(x.v, y.v));
+    _mm_storeu_ps(floats + 4, _mm_unpackhi_ps(x.v, y.v));
+#elif defined(LEPONG_SIMD_NEON)
+    vst2q_f32(reinterpret_cast<float*>(p), float32x4x2_t{ { x.v, y.v } });
+#else
+    for (auto i = 0; i < skWidth; ++i)
+    {
+        p[i] = { x.v[i], y.v[i] };
+    }
+#endif
+}
+
+template<>
+inline Vector2x8f Vector2x8f::Load(const Vector2f* p) noexcept
+{
+#if defined(LEPONG_SIMD_AVX)
+    const auto* kFloats = reinterpret_cast<const float*>(p);
+
+    const auto kFirst = _mm256_loadu_ps(kFloats);
+    const auto kSecond = _mm256_loadu_ps(kFloats + 8);
+
+    // Vectors 0, 1, 4, 5 then 2, 3, 6, 7 so that the in-lane shuffles give the components in order.
+    const auto kLow = _mm256_permute2f128_ps(kFirst, kSecond, 0x20);
+    const auto kHigh = _mm256_permute2f128_ps(kFirst, kSecond, 0x31);
+
+    return { { _mm256_shuffle_ps(kLow, kHigh, _MM_SHUFFLE(2, 0, 2, 0)) }, { _mm256_shuffle_ps(kLow, kHigh, _MM_SHUFFLE(3, 1, 3, 1)) } };
+#else
+    const auto kLow = Vector2x4f::Load(p);
+    const auto kHigh = Vector2x4f::Load(p + 4);
+
+    return { { { kLow.x, kHigh.x } }, { { kLow.y, kHigh.y } } };
+#endif
+}
+
+template<>
+inline void Vector2x8f::Store(Vector2f* p) const noexcept
+{
+#if defined(LEPONG_SIMD_AVX)
+    auto* floats = reinterpret_cast<float*>(p);
+
+    const auto kLow = _mm256_unpacklo_ps(x.v, y.v);
+    const auto kHigh = _mm256_unpackhi_ps(x.v, y.v);
+
+    _mm256_storeu_ps(floats, _mm256_permute2f128_ps(kLow, kHigh, 0x20));
+    _mm256_storeu_ps(floats + 8, _mm256_permute2f128_ps(kLow, kHigh, 0x31));
+#else
+    Vector2x4f{ x.v[0], y.v[0] }.Store(p);
+    Vector2x4f{ x.v[1], y.v[1] }.Store(p + 4);
+#endif
+}
+
+} // inline namespace LEPONG_SIMD_NAMESPACE
+
+} // namespace lepong
@@ -0,0 +1,47 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "lepong/Attribute.h"
+
+#include "Vector2.h"
+
+namespace lepong
+{
+
+// Operations over arrays of vectors. They use the widest instruction set the CPU supports and give the same results
+// as doing the corresponding Vector2 operation on each element, except for the Fast functions.
+//
+// The input and output arrays may be the same array but must not partially overlap.
+
+///
+/// <code>out[i] = Normalize(in[i])</code>
+///
+void Normalize(const Vector2f* in, Vector2f* out, std::size_t count) noexcept;
+
+///
+/// Same as <i>Normalize</i> but with an approximate inverse square root.<br>
+/// Each component is off by at most <i>skInverseSqrtFastMaxError</i> relative to the exact result.
+///
+void NormalizeFast(const Vector2f* in, Vector2f* out, std::size_t count) noexcept;
+
+///
+/// <code>out[i] = in[i].SquareMag()</code>
+///
+void SquareMag(const Vector2f* in, float* out, std::size_t count) noexcept;
+
+///
+/// <code>positions[i] += directions[i] * speeds[i] * delta</code>, which is what <i>GameObject::Update</i> does.
+///
+void MultiplyAdd(Vector2f* positions, const Vector2f* directions, const float* speeds, float delta, std::size_t count) noexcept;
+
+///
+/// An approximation of <code>1 / sqrtf(s)</code> within <i>skInverseSqrtFastMaxError</i>.
+///
+LEPONG_NODISCARD float InverseSqrtFast(float s) noexcept;
+
+} // namespace lepong
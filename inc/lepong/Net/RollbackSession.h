@@ -0,0 +1,150 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Sim/Snapshot.h"
+
+#include "Transport.h"
+
+namespace lepong::Net
+{
+
+struct RollbackSettings
+{
+    // The paddle this peer controls, the remote peer controls the other one.
+    unsigned localPlayer = 0;
+
+    // Local inputs are applied this many ticks late, which hides that much latency without rolling back.
+    unsigned inputDelay = 0;
+
+    // How many ticks the simulation may run ahead of the last remote input before waiting for it.
+    unsigned maxPrediction = 8;
+
+    float tickDelta = 1.0f / 240.0f;
+};
+
+struct RollbackStats
+{
+    unsigned long long rollbacks = 0;
+    unsigned long long resimulatedTicks = 0;
+    unsigned maxRollbackTicks = 0;
+
+    // The time spent restoring and simulating again, in seconds.
+    double rollbackTime = 0.0;
+    double maxRollbackTime = 0.0;
+
+    // Frames where the simulation waited for remote inputs.
+    unsigned long long stalls = 0;
+
+    unsigned long long packetsSent = 0;
+    unsigned long long packetsReceived = 0;
+};
+
+///
+/// Plays a match against a remote peer with rollback, GGPO style.<br><br>
+///
+/// The remote paddle is predicted to keep doing what it last did, so the match never waits for the network unless it
+/// gets more than <i>maxPrediction</i> ticks ahead. When a remote input arrives that doesn't match the prediction,
+/// the match is restored to that tick and simulated again up to the current tick, within the same frame.<br><br>
+///
+/// Both peers must start from the same match, random generator included. Balls are launched as soon as they wait
+/// so that the launches happen on the same tick on both sides.
+///
+class RollbackSession
+{
+public:
+    RollbackSession(const RollbackSettings& settings, Transport& transport, const Match& match) noexcept;
+
+public:
+    ///
+    /// Exchanges inputs with the remote peer, rolls back if needed and simulates the next tick with the local action.
+    /// Call once per frame at the tick rate.
+    ///
+    /// \return Whether a tick was simulated. If not, the simulation waits for the remote peer and the action wasn't
+    /// used, it should be provided again next frame.
+    ///
+    bool AdvanceFrame(PaddleAction localAction) noexcept;
+
+public:
+    LEPONG_NODISCARD const Match& GetMatch() const noexcept
+    {
+        return mMatch;
+    }
+
+    ///
+    /// \return The next tick to simulate.
+    ///
+    LEPONG_NODISCARD std::uint64_t GetTick() const noexcept
+    {
+        return static_cast<std::uint64_t>(mTick);
+    }
+
+    ///
+    /// \return The number of ticks whose inputs are all known. The state at the start of this tick is final.
+    ///
+    LEPONG_NODISCARD std::uint64_t GetConfirmedTicks() const noexcept
+    {
+        return static_cast<std::uint64_t>(mConfirmedRemote + 1);
+    }
+
+    ///
+    /// \return The states at the start of the last ticks.
+    ///
+    LEPONG_NODISCARD const SnapshotRing& GetSnapshots() const noexcept
+    {
+        return mSnapshots;
+    }
+
+    LEPONG_NODISCARD const RollbackStats& GetStats() const noexcept
+    {
+        return mStats;
+    }
+
+private:
+    void ReceiveInputs(double now) noexcept;
+    void SendInputs(double now) noexcept;
+
+    void Rollback(std::int64_t tick) noexcept;
+    void SimulateTick(std::int64_t tick) noexcept;
+
+    LEPONG_NODISCARD PaddleAction GetRemoteInput(std::int64_t tick) const noexcept;
+
+private:
+    static constexpr std::size_t skInputHistory = 256;
+    static constexpr std::size_t skInputMask = skInputHistory - 1;
+
+    RollbackSettings mSettings;
+    Transport& mTransport;
+
+    Match mMatch;
+    SnapshotRing mSnapshots;
+
+    std::int64_t mTick = 0;
+    std::int64_t mFrame = 0;
+
+    PaddleAction mLocalInputs[skInputHistory] = {};
+    PaddleAction mRemoteInputs[skInputHistory] = {};
+
+    // The remote input each tick was simulated with, to spot wrong predictions.
+    PaddleAction mUsedRemoteInputs[skInputHistory] = {};
+
+    // The last local tick with an input and the last tick with a remote input, -1 if none.
+    std::int64_t mLastLocalInput = -1;
+    std::int64_t mConfirmedRemote = -1;
+
+    // The last tick of our inputs the remote peer has, the next packets start after it.
+    std::int64_t mRemoteAck = -1;
+
+    // The earliest tick that was simulated with a wrong prediction, or mTick if none.
+    std::int64_t mRollbackTick = 0;
+
+    RollbackStats mStats;
+};
+
+} // namespace lepong::Net
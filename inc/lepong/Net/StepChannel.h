@@ -0,0 +1,210 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "lepong/Attribute.h"
+
+namespace lepong::Net
+{
+
+enum class StepCommand : std::uint32_t
+{
+    Reset,
+    Step,
+    Close
+};
+
+///
+/// How a side of a StepChannel waits for the other.<br><br>
+///
+/// <code>Futex</code> yields for a short while then sleeps until woken, so an idle side costs nothing.
+/// <code>Poll</code> never sleeps and answers a little faster, but keeps a CPU busy. Futexes only exist on Linux,
+/// elsewhere both poll.
+///
+enum class StepWait
+{
+    Futex,
+    Poll
+};
+
+///
+/// Lets a trainer in another process step environments through shared memory, without a system call per step when
+/// both sides are busy.<br><br>
+///
+/// The simulator creates the channel and the trainer opens it by name. The region holds two single producer single
+/// consumer rings, commands from the trainer and results from the simulator, and <code>skSlotCount</code> sets of
+/// buffers for the actions, observations, rewards and episode ends. A command names the buffer set it is about, which
+/// is answered with the same set once it's filled, so a few requests can be in flight.
+///
+class StepChannel
+{
+public:
+    static constexpr std::uint32_t skSlotCount = 4;
+
+public:
+    StepChannel() noexcept = default;
+    ~StepChannel() noexcept;
+
+    StepChannel(const StepChannel&) = delete;
+    StepChannel& operator=(const StepChannel&) = delete;
+
+public:
+    ///
+    /// Creates the shared memory named <i>name</i> for the simulator side, replacing a channel left behind by a
+    /// simulator that didn't exit cleanly.
+    ///
+    /// \param observationSize The size of the observation of one environment, in bytes.
+    ///
+    /// \return Whether the shared memory could be created.
+    ///
+    bool Create(const char* name, std::uint32_t envCount, std::uint32_t observationSize) noexcept;
+
+    ///
+    /// Opens the channel a simulator created, for the trainer side.
+    ///
+    /// \return Whether the channel exists and is valid.
+    ///
+    bool Open(const char* name) noexcept;
+
+    ///
+    /// Tells the other side that this side is gone, then unmaps the channel. The simulator side also removes the name.
+    ///
+    void Close() noexcept;
+
+    void SetWait(StepWait wait) noexcept
+    {
+        mWait = wait;
+    }
+
+public:
+    // The trainer side.
+
+    ///
+    /// \return Whether the command could be sent: false if the other side is gone or <code>skSlotCount</code>
+    /// commands are already waiting for their results.
+    ///
+    bool Submit(StepCommand command, std::uint32_t slot) noexcept;
+
+    ///
+    /// Waits for the result of the oldest command.
+    ///
+    /// \return Whether a result came, in which case <i>slot</i> is set to its buffer set. False if the other side is
+    /// gone.
+    ///
+    bool WaitResult(std::uint32_t& slot) noexcept;
+
+public:
+    // The simulator side.
+
+    ///
+    /// \return Whether a command came, false if the other side is gone.
+    ///
+    bool WaitCommand(StepCommand& command, std::uint32_t& slot) noexcept;
+
+    ///
+    /// Tells the trainer that the buffers of <i>slot</i> are filled.
+    ///
+    void Complete(std::uint32_t slot) noexcept;
+
+public:
+    LEPONG_NODISCARD bool IsOpen() const noexcept
+    {
+        return mData != nullptr;
+    }
+
+    LEPONG_NODISCARD std::uint32_t GetEnvCount() const noexcept
+    {
+        return mEnvCount;
+    }
+
+    LEPONG_NODISCARD std::uint32_t GetObservationSize() const noexcept
+    {
+        return mObservationSize;
+    }
+
+    // Every buffer is 64 byte aligned.
+
+    LEPONG_NODISCARD std::int32_t* GetActions(std::uint32_t slot) const noexcept
+    {
+        return reinterpret_cast<std::int32_t*>(GetSlot(slot));
+    }
+
+    LEPONG_NODISCARD float* GetRewards(std::uint32_t slot) const noexcept
+    {
+        return reinterpret_cast<float*>(GetSlot(slot) + mRewardsOffset);
+    }
+
+    LEPONG_NODISCARD std::uint8_t* GetDones(std::uint32_t slot) const noexcept
+    {
+        return GetSlot(slot) + mDonesOffset;
+    }
+
+    LEPONG_NODISCARD std::uint8_t* GetObservations(std::uint32_t slot) const noexcept
+    {
+        return GetSlot(slot) + mObservationsOffset;
+    }
+
+private:
+    struct Ring;
+    struct Header;
+
+    ///
+    /// Computes the buffer offsets from the environment count and observation size.
+    ///
+    /// \return The size of the whole region.
+    ///
+    std::size_t SetLayout(std::uint32_t envCount, std::uint32_t observationSize) noexcept;
+
+    ///
+    /// Maps <i>mSize</i> bytes of the shared memory, creating it if <i>create</i> is set.
+    ///
+    bool Map(const char* name, bool create) noexcept;
+
+    ///
+    /// Unmaps the shared memory without telling the other side, for a channel this side never joined.
+    ///
+    void Unmap() noexcept;
+
+    LEPONG_NODISCARD Header& GetHeader() const noexcept
+    {
+        return *reinterpret_cast<Header*>(mData);
+    }
+
+    LEPONG_NODISCARD std::uint8_t* GetSlot(std::uint32_t slot) const noexcept
+    {
+        return mData + mSlotsOffset + (slot % skSlotCount) * mSlotSize;
+    }
+
+    bool Push(Ring& ring, std::uint32_t entry) noexcept;
+    bool Pop(Ring& ring, std::uint32_t& entry) noexcept;
+
+private:
+    std::uint8_t* mData = nullptr;
+    std::size_t mSize = 0;
+
+    // The file mapping on Windows, unused elsewhere.
+    void* mMapping = nullptr;
+
+    // Set on the simulator side, which removes the name when closing.
+    bool mCreator = false;
+    std::string mName;
+
+    StepWait mWait = StepWait::Futex;
+
+    std::uint32_t mEnvCount = 0;
+    std::uint32_t mObservationSize = 0;
+
+    std::size_t mSlotsOffset = 0;
+    std::size_t mSlotSize = 0;
+    std::size_t mRewardsOffset = 0;
+    std::size_t mDonesOffset = 0;
+    std::size_t mObservationsOffset = 0;
+};
+
+} // namespace lepong::Net
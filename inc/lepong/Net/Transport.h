@@ -0,0 +1,106 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Math/Random.h"
+
+namespace lepong::Net
+{
+
+using Packet = std::vector<std::uint8_t>;
+
+///
+/// Sends and receives unreliable packets, which may arrive late, out of order or never.<br><br>
+///
+/// Times are in seconds on the caller's clock, so that a whole session can run on simulated time.
+///
+class Transport
+{
+public:
+    virtual ~Transport() noexcept = default;
+
+public:
+    virtual void Send(const std::uint8_t* data, std::size_t size, double now) noexcept = 0;
+
+    ///
+    /// \return Whether a packet was received, in which case it's in <i>packet</i>.
+    ///
+    virtual bool Receive(Packet& packet, double now) noexcept = 0;
+};
+
+///
+/// How bad a simulated network is.
+///
+struct LinkConditions
+{
+    // In seconds. Each packet is delayed by the latency plus a random part of the jitter, so jitter reorders packets.
+    double latency = 0.0;
+    double jitter = 0.0;
+
+    // The chance of a packet being dropped, in [0, 1].
+    float loss = 0.0f;
+
+    std::uint64_t seed = 0;
+};
+
+///
+/// Applies link conditions to packets: holds them until they are due, in the order they are due, and drops some.
+///
+class SimulatedLink
+{
+public:
+    explicit SimulatedLink(const LinkConditions& conditions = {}) noexcept;
+
+public:
+    void Push(const std::uint8_t* data, std::size_t size, double now) noexcept;
+
+    ///
+    /// \return Whether a packet is due at <i>now</i>, in which case it's moved to <i>packet</i>.
+    ///
+    bool Pop(Packet& packet, double now) noexcept;
+
+private:
+    struct Pending
+    {
+        double dueTime;
+        Packet packet;
+    };
+
+    LinkConditions mConditions;
+    Random mRandom;
+
+    // Sorted by due time.
+    std::deque<Pending> mPending;
+};
+
+///
+/// An in-process transport, connected to another one with <i>Connect</i>.
+///
+class LoopbackTransport : public Transport
+{
+public:
+    explicit LoopbackTransport(const LinkConditions& conditions = {}) noexcept;
+
+    ///
+    /// Makes the two transports send to each other. Each one applies its own conditions to what it sends.
+    ///
+    static void Connect(LoopbackTransport& a, LoopbackTransport& b) noexcept;
+
+public:
+    void Send(const std::uint8_t* data, std::size_t size, double now) noexcept override;
+    bool Receive(Packet& packet, double now) noexcept override;
+
+private:
+    SimulatedLink mOutgoing;
+    LoopbackTransport* mPeer = nullptr;
+};
+
+} // namespace lepong::Net
@@ -0,0 +1,55 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "Transport.h"
+
+namespace lepong::Net
+{
+
+///
+/// A transport over a UDP socket bound to the loopback interface, talking to another port of the same machine.<br>
+/// The link conditions are applied before sending, on top of whatever the real network does.
+///
+class UdpTransport : public Transport
+{
+public:
+    explicit UdpTransport(const LinkConditions& conditions = {}) noexcept;
+    ~UdpTransport() noexcept override;
+
+    UdpTransport(const UdpTransport&) = delete;
+    UdpTransport& operator=(const UdpTransport&) = delete;
+
+public:
+    ///
+    /// Binds 127.0.0.1:<i>localPort</i> and sends to 127.0.0.1:<i>remotePort</i>.
+    ///
+    /// \return Whether the socket could be created and bound.
+    ///
+    bool Open(std::uint16_t localPort, std::uint16_t remotePort) noexcept;
+
+    void Close() noexcept;
+
+public:
+    void Send(const std::uint8_t* data, std::size_t size, double now) noexcept override;
+    bool Receive(Packet& packet, double now) noexcept override;
+
+private:
+    ///
+    /// Actually sends the packets the link conditions held back until now.
+    ///
+    void Flush(double now) noexcept;
+
+private:
+    SimulatedLink mOutgoing;
+
+    // A SOCKET on Windows, a file descriptor elsewhere.
+    std::intptr_t mSocket = -1;
+    std::uint16_t mRemotePort = 0;
+};
+
+} // namespace lepong::Net
@@ -0,0 +1,76 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+
+namespace lepong
+{
+
+// Event driven simulation. Between two contacts the ball moves in a straight line and the paddles move toward
+// their target at a constant speed, so instead of ticking, the time of the next event is computed in closed form
+// and the match jumps straight to it.
+//
+// The events are: the ball touching the top or bottom wall, the ball reaching the front plane of the paddle it
+// moves toward, the ball reaching a side and the periodic decision point if there is one. The paddles are only
+// asked what to do at these events.
+
+///
+/// What a paddle does until the next decision point: move toward <i>targetY</i> at full speed and stop there.
+///
+struct PaddleCommand
+{
+    float targetY = 0.0f;
+};
+
+///
+/// Decides what a paddle does at a decision point.
+///
+/// \param player The index of the paddle, 0 or 1.
+///
+using PFNPaddleController = PaddleCommand (*)(const Match& match, unsigned player, void* userData);
+
+struct PaddleController
+{
+    PFNPaddleController function = nullptr;
+    void* userData = nullptr;
+};
+
+struct FastForwardSettings
+{
+    PaddleController controllers[2];
+
+    // The time between two decision points when nothing happens, 0 to only decide at events.
+    float decisionInterval = 0.0f;
+
+    // Stops a point that never ends, in seconds of match time.
+    float maxTime = 600.0f;
+};
+
+struct FastForwardStats
+{
+    unsigned long long events = 0;
+    double time = 0.0;
+};
+
+///
+/// Plays the match from event to event until a point is scored or <i>settings.maxTime</i> is elapsed.<br>
+/// The ball must already be launched, otherwise nothing happens.<br><br>
+///
+/// Ball contacts are handled like <i>Match::Update</i> does: walls flip the vertical direction and paddles call
+/// <i>Ball::OnPaddleCollision</i>, with the paddle's grace zone. Reaching a side scores and resets the match.
+///
+/// \return The side that lost the point or <code>Side::None</code>.
+///
+Side FastForwardPoint(Match& match, const FastForwardSettings& settings, FastForwardStats& stats) noexcept;
+
+///
+/// A controller that moves the paddle to where the ball will cross its front, found by folding the ball's path
+/// across the walls. It hits the ball off center to send it away from the opponent.
+///
+LEPONG_NODISCARD PaddleCommand InterceptBall(const Match& match, unsigned player, void* userData) noexcept;
+
+} // namespace lepong
@@ -0,0 +1,191 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Sim/MatchRules.h"
+
+namespace lepong
+{
+
+///
+/// The code used to step a batch.
+///
+enum class BatchKernel
+{
+    // The best kernel supported by the CPU.
+    Auto,
+
+    // Steps every match with a Match object. Slow, but this is what the other kernels must match bit-for-bit.
+    Reference,
+
+    // Branch-free, one match at a time. Used on CPUs without any of the kernels below.
+    Scalar,
+
+    SSE2,
+    AVX2
+};
+
+///
+/// Many matches stored as a struct of arrays so they can all be stepped at once with SIMD kernels.<br><br>
+///
+/// Every match uses the arena and object sizes from <i>Match</i>, and the speeds and paddle height of the rules of
+/// the batch. The paddle x positions never change so they aren't stored. Paddle arrays are indexed by player: <code>paddleY[0]</code> is the first paddle of every match.
+///
+class MatchBatch
+{
+public:
+    std::vector<float> ballX;
+    std::vector<float> ballY;
+    std::vector<float> ballDirX;
+    std::vector<float> ballDirY;
+    std::vector<float> ballSpeed;
+
+    std::vector<float> paddleY[2];
+    std::vector<float> paddleDir[2];
+    std::vector<float> paddleSpeed[2];
+
+    std::vector<std::uint32_t> scores[2];
+
+    // 1 while the ball is in play, 0 while it waits to be launched.
+    std::vector<std::uint32_t> playing;
+
+    // How many times each ball was launched, which picks the random block of the next launch.
+    std::vector<std::uint32_t> launches;
+
+public:
+    ///
+    /// Creates <i>size</i> matches in the same state as a new <i>Match</i>.<br>
+    /// The kernel is set to <code>BatchKernel::Auto</code>.
+    ///
+    explicit MatchBatch(std::size_t size) noexcept;
+
+public:
+    LEPONG_NODISCARD std::size_t Size() const noexcept
+    {
+        return mSize;
+    }
+
+    ///
+    /// Sets the kernel used by <i>Step</i>.<br>
+    /// If the kernel isn't supported by the CPU, the best supported kernel is used instead.
+    ///
+    void SetKernel(BatchKernel kernel) noexcept;
+
+    ///
+    /// \return The kernel used by <i>Step</i>, never <code>BatchKernel::Auto</code>.
+    ///
+    LEPONG_NODISCARD BatchKernel GetKernel() const noexcept
+    {
+        return mKernel;
+    }
+
+    ///
+    /// Sets the seed of the launch directions. Launch n of match i uses block n of stream <i>firstStream</i> + i of a
+    /// counter-based generator, so the directions don't depend on the order the matches are launched in. Batches
+    /// playing parts of the same set of matches give each part its own streams with <i>firstStream</i>.<br>
+    /// The seed and the first stream are 0 by default.
+    ///
+    void SetSeed(std::uint64_t seed, std::uint64_t firstStream = 0) noexcept;
+
+    ///
+    /// Sets the rules every match of the batch plays with, the game's by default. The reference kernel steps
+    /// <i>Match</i> objects, so it only plays with the default rules, and <i>Load</i> and <i>Store</i> keep the
+    /// positions of the game's arena.
+    ///
+    void SetRules(const MatchRules& rules) noexcept;
+
+    LEPONG_NODISCARD const MatchRules& GetRules() const noexcept
+    {
+        return mRules;
+    }
+
+    ///
+    /// Sets whether <i>Step</i> uses the kernels compiled for <i>GameRules</i> when the batch plays with the default
+    /// rules, which is the default. Otherwise every rule is read at runtime, which is only useful to measure what
+    /// knowing the rules at compile time saves.
+    ///
+    void SetSpecialized(bool specialized) noexcept;
+
+public:
+    ///
+    /// Copies the provided match into the batch at the provided index.
+    ///
+    void Load(std::size_t index, const Match& match) noexcept;
+
+    ///
+    /// Copies the match at the provided index into <i>match</i>.
+    ///
+    void Store(std::size_t index, Match& match) const noexcept;
+
+    ///
+    /// Resets the match at the provided index to the state of a new <i>Match</i>, scores included.
+    ///
+    void Restart(std::size_t index) noexcept;
+
+public:
+    ///
+    /// Same as <i>Match::Launch</i> for the match at the provided index, except the direction comes from the seed of
+    /// the batch instead of the random generator of the match, and the speed from its rules.
+    ///
+    void Launch(std::size_t index) noexcept;
+
+    ///
+    /// Launches every match that is not being played, in index order.
+    ///
+    void LaunchWaiting() noexcept;
+
+    ///
+    /// Applies the paddle actions then advances every match by the provided delta, exactly like calling
+    /// <i>Paddle::ApplyAction</i> on both paddles then <i>Match::Update</i> on each match.
+    ///
+    /// \param actions <code>2 * Size()</code> actions: the first paddle of every match, then the second paddle.
+    ///
+    void Step(float delta, const PaddleAction* actions) noexcept;
+
+private:
+    std::size_t mSize;
+    BatchKernel mKernel = BatchKernel::Auto;
+
+    Philox4x32 mRandom;
+
+    MatchRules mRules;
+    bool mDefaultRules = true;
+    bool mSpecialized = true;
+};
+
+///
+/// \return Whether the kernel can run on this CPU. <code>BatchKernel::Auto</code> is always supported.
+///
+LEPONG_NODISCARD bool IsBatchKernelSupported(BatchKernel kernel) noexcept;
+
+///
+/// \return The fastest kernel this CPU supports.
+///
+LEPONG_NODISCARD BatchKernel GetBestBatchKernel() noexcept;
+
+///
+/// \return The kernel's name, as accepted by <i>ParseBatchKernel</i>.
+///
+LEPONG_NODISCARD const char* GetBatchKernelName(BatchKernel kernel) noexcept;
+
+///
+/// \return Whether <i>name</i> is a kernel name, in which case <i>kernel</i> is set.
+///
+LEPONG_NODISCARD bool ParseBatchKernel(const char* name, BatchKernel& kernel) noexcept;
+
+///
+/// Fills the actions array with <i>TrackBall</i> for both paddles of every match.
+///
+/// \param actions <code>2 * batch.Size()</code> actions, laid out like <i>MatchBatch::Step</i> expects.
+///
+void FillTrackBallActions(const MatchBatch& batch, PaddleAction* actions, float deadZone = 10.0f) noexcept;
+
+} // namespace lepong
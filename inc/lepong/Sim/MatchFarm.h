@@ -0,0 +1,142 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Sim/Replay.h"
+
+namespace lepong
+{
+
+///
+/// What a farm keeps of a match once it's played.
+///
+struct MatchResult
+{
+    unsigned scores[2] = { 0u, 0u };
+    unsigned long long ticks = 0;
+};
+
+///
+/// Plays a whole match. Called from the farm threads, so <i>userData</i> must be safe to read concurrently.
+///
+/// \param match A new match with its random generator already seeded for <i>index</i>.
+/// \param index The index of the match in the run.
+///
+using PFNPlayMatch = void (*)(Match& match, std::size_t index, MatchResult& result, void* userData);
+
+struct MatchFarmSettings
+{
+    // 0 uses one thread per hardware thread.
+    unsigned threads = 0;
+
+    // Pins thread i to CPU i so that the threads don't move around, only on Windows and Linux.
+    bool pinThreads = false;
+
+    // The seed of the match generators, match i gets stream i.
+    std::uint64_t seed = 0;
+};
+
+///
+/// Plays independent matches on a pool of threads.<br><br>
+///
+/// The matches of a run are split evenly between the threads and threads that run out of matches steal half of
+/// what's left to another. Every match is seeded from its index and its result is stored at its index, so the
+/// results are the same for any number of threads.
+///
+class MatchFarm
+{
+public:
+    ///
+    /// Starts the threads, they sleep until <i>Run</i> is called.
+    ///
+    explicit MatchFarm(const MatchFarmSettings& settings) noexcept;
+
+    ///
+    /// Stops the threads.
+    ///
+    ~MatchFarm() noexcept;
+
+    MatchFarm(const MatchFarm&) = delete;
+    MatchFarm& operator=(const MatchFarm&) = delete;
+
+public:
+    ///
+    /// Plays <i>count</i> matches and waits for all of them to finish.
+    ///
+    /// \param results Where the result of match i goes, <i>count</i> elements.
+    ///
+    void Run(std::size_t count, PFNPlayMatch play, void* userData, MatchResult* results) noexcept;
+
+public:
+    LEPONG_NODISCARD unsigned GetThreadCount() const noexcept
+    {
+        return static_cast<unsigned>(mThreads.size());
+    }
+
+    ///
+    /// \return How many times threads stole matches during the last run.
+    ///
+    LEPONG_NODISCARD unsigned long long GetSteals() const noexcept;
+
+private:
+    struct Worker;
+
+    void WorkerMain(unsigned index) noexcept;
+    void Work(unsigned index) noexcept;
+
+    LEPONG_NODISCARD bool PopMatch(unsigned index, std::size_t& match) noexcept;
+    LEPONG_NODISCARD bool Steal(unsigned index) noexcept;
+
+private:
+    MatchFarmSettings mSettings;
+
+    std::unique_ptr<Worker[]> mWorkers;
+    std::vector<std::thread> mThreads;
+
+    std::mutex mMutex;
+    std::condition_variable mStart;
+    std::condition_variable mDone;
+
+    // Incremented by every run, the threads wake up when it changes.
+    unsigned long long mGeneration = 0;
+    unsigned mRunning = 0;
+    bool mStopping = false;
+
+    PFNPlayMatch mPlay = nullptr;
+    void* mUserData = nullptr;
+    MatchResult* mResults = nullptr;
+};
+
+struct BotMatchSettings
+{
+    unsigned points = 5;
+    float delta = 1.0f / 240.0f;
+    bool continuousCollision = false;
+
+    // Stops matches that somehow never end.
+    unsigned long long maxTicks = 10'000'000ull;
+
+    // When set, match i is recorded to replays[i].
+    Replay* replays = nullptr;
+};
+
+///
+/// Plays a match between two <i>TrackBall</i> bots until a player reaches the required points.
+///
+/// \param userData A <i>BotMatchSettings</i>.
+///
+void PlayBotMatch(Match& match, std::size_t index, MatchResult& result, void* userData) noexcept;
+
+} // namespace lepong
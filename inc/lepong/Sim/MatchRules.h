@@ -0,0 +1,189 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Game/Match.h"
+
+namespace lepong
+{
+
+///
+/// The gameplay values a <i>MatchBatch</i> can play with instead of the ones hardcoded in the game objects. The
+/// defaults are the values of the game.
+///
+struct MatchRules
+{
+    // The speed of a launched ball, Ball::skDefaultMoveSpeed.
+    float ballSpeed = Ball::skDefaultMoveSpeed;
+
+    // Paddle::skDefaultMoveSpeed.
+    float paddleSpeed = Paddle::skDefaultMoveSpeed;
+
+    // Added to the ball speed by every paddle hit, in Ball::OnPaddleCollision.
+    float hitSpeedGain = 50.0f;
+
+    // How far past its ends a paddle still hits the ball, in paddle heights. See Ball::DoCollideWith.
+    float graceZone = 0.1f;
+
+    // The height of Match::skPaddleSize.
+    float paddleHeight = Match::skPaddleSize.y;
+
+    // The geometry of Match, whole numbers of pixels for the arena.
+    Vector2f arenaSize = { static_cast<float>(Match::skArenaSize.x), static_cast<float>(Match::skArenaSize.y) };
+    float ballRadius = Match::skBallRadius;
+    float paddleWidth = Match::skPaddleSize.x;
+    float paddleBorderOffset = Match::skPaddleBorderOffset;
+
+public:
+    LEPONG_NODISCARD bool IsDefault() const noexcept
+    {
+        const MatchRules kDefault;
+
+        return
+            ballSpeed == kDefault.ballSpeed &&
+            paddleSpeed == kDefault.paddleSpeed &&
+            hitSpeedGain == kDefault.hitSpeedGain &&
+            graceZone == kDefault.graceZone &&
+            paddleHeight == kDefault.paddleHeight &&
+            arenaSize.x == kDefault.arenaSize.x &&
+            arenaSize.y == kDefault.arenaSize.y &&
+            ballRadius == kDefault.ballRadius &&
+            paddleWidth == kDefault.paddleWidth &&
+            paddleBorderOffset == kDefault.paddleBorderOffset;
+    }
+};
+
+// Rule policies. Simulation code templated on a policy reads every value of the rules through it, computed exactly
+// like Ball.cpp, Paddle.cpp and Match.cpp compute them. Both policies have the same functions, only GameRules' are
+// constant expressions.
+
+///
+/// The rules of the game, known at compile time so that the compiler folds them into the code using them.
+///
+struct GameRules
+{
+    LEPONG_NODISCARD static constexpr float GetArenaWidth() noexcept
+    {
+        return static_cast<float>(Match::skArenaSize.x);
+    }
+
+    LEPONG_NODISCARD static constexpr float GetArenaHeight() noexcept
+    {
+        return static_cast<float>(Match::skArenaSize.y);
+    }
+
+    LEPONG_NODISCARD static constexpr float GetBallSpeed() noexcept
+    {
+        return Ball::skDefaultMoveSpeed;
+    }
+
+    LEPONG_NODISCARD static constexpr float GetBallRadius() noexcept
+    {
+        return Match::skBallRadius;
+    }
+
+    LEPONG_NODISCARD static constexpr float GetPaddleSpeed() noexcept
+    {
+        return Paddle::skDefaultMoveSpeed;
+    }
+
+    LEPONG_NODISCARD static constexpr float GetHitSpeedGain() noexcept
+    {
+        return 50.0f;
+    }
+
+    LEPONG_NODISCARD static constexpr float GetPaddleHalfWidth() noexcept
+    {
+        return Match::skPaddleSize.x / 2.0f;
+    }
+
+    LEPONG_NODISCARD static constexpr float GetPaddleHalfHeight() noexcept
+    {
+        return Match::skPaddleSize.y / 2.0f;
+    }
+
+    ///
+    /// Paddle::CollideWithTerrain.
+    ///
+    LEPONG_NODISCARD static constexpr float GetPaddleMinTerrainOffset() noexcept
+    {
+        return Match::skPaddleSize.y * 0.1f;
+    }
+
+    LEPONG_NODISCARD static constexpr float GetPaddleTopLimit() noexcept
+    {
+        return GetArenaHeight() - GetPaddleHalfHeight();
+    }
+
+    ///
+    /// Ball::DoCollideWith.
+    ///
+    LEPONG_NODISCARD static constexpr float GetPaddleGraceZone() noexcept
+    {
+        return Match::skPaddleSize.y * 0.1f;
+    }
+
+    ///
+    /// Match::PositionPaddlesOnTerrain.
+    ///
+    LEPONG_NODISCARD static constexpr float GetPaddleX(unsigned player) noexcept
+    {
+        return player ? Match::skArenaSize.x - Match::skPaddleBorderOffset : Match::skPaddleBorderOffset;
+    }
+};
+
+///
+/// The same values as <i>GameRules</i> computed from a <i>MatchRules</i>, for code that must play with rules only
+/// known at runtime.
+///
+class RuntimeRules
+{
+public:
+    explicit RuntimeRules(const MatchRules& rules) noexcept
+        : mArenaWidth(rules.arenaSize.x)
+        , mArenaHeight(rules.arenaSize.y)
+        , mBallSpeed(rules.ballSpeed)
+        , mBallRadius(rules.ballRadius)
+        , mPaddleSpeed(rules.paddleSpeed)
+        , mHitSpeedGain(rules.hitSpeedGain)
+        , mPaddleHalfWidth(rules.paddleWidth / 2.0f)
+        , mPaddleHalfHeight(rules.paddleHeight / 2.0f)
+        , mPaddleMinTerrainOffset(rules.paddleHeight * 0.1f)
+        , mPaddleTopLimit(rules.arenaSize.y - rules.paddleHeight / 2.0f)
+        , mPaddleGraceZone(rules.paddleHeight * rules.graceZone)
+        , mPaddleX{ rules.paddleBorderOffset, rules.arenaSize.x - rules.paddleBorderOffset }
+    {
+    }
+
+public:
+    LEPONG_NODISCARD float GetArenaWidth() const noexcept { return mArenaWidth; }
+    LEPONG_NODISCARD float GetArenaHeight() const noexcept { return mArenaHeight; }
+    LEPONG_NODISCARD float GetBallSpeed() const noexcept { return mBallSpeed; }
+    LEPONG_NODISCARD float GetBallRadius() const noexcept { return mBallRadius; }
+    LEPONG_NODISCARD float GetPaddleSpeed() const noexcept { return mPaddleSpeed; }
+    LEPONG_NODISCARD float GetHitSpeedGain() const noexcept { return mHitSpeedGain; }
+    LEPONG_NODISCARD float GetPaddleHalfWidth() const noexcept { return mPaddleHalfWidth; }
+    LEPONG_NODISCARD float GetPaddleHalfHeight() const noexcept { return mPaddleHalfHeight; }
+    LEPONG_NODISCARD float GetPaddleMinTerrainOffset() const noexcept { return mPaddleMinTerrainOffset; }
+    LEPONG_NODISCARD float GetPaddleTopLimit() const noexcept { return mPaddleTopLimit; }
+    LEPONG_NODISCARD float GetPaddleGraceZone() const noexcept { return mPaddleGraceZone; }
+    LEPONG_NODISCARD float GetPaddleX(unsigned player) const noexcept { return mPaddleX[player ? 1 : 0]; }
+
+private:
+    float mArenaWidth;
+    float mArenaHeight;
+    float mBallSpeed;
+    float mBallRadius;
+    float mPaddleSpeed;
+    float mHitSpeedGain;
+    float mPaddleHalfWidth;
+    float mPaddleHalfHeight;
+    float mPaddleMinTerrainOffset;
+    float mPaddleTopLimit;
+    float mPaddleGraceZone;
+    float mPaddleX[2];
+};
+
+} // namespace lepong
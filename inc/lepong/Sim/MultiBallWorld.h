@@ -0,0 +1,156 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Math/Random.h"
+
+namespace lepong
+{
+
+class WorkerGroup;
+
+struct MultiBallSettings
+{
+    Vector2i arenaSize = Match::skArenaSize;
+
+    // Small balls so that lots of them fit in the arena.
+    float ballRadius = 1.0f;
+    float ballSpeed = Ball::skDefaultMoveSpeed;
+
+    bool ballCollisions = true;
+
+    // The number of threads building the grid, the calling thread included.
+    unsigned gridThreads = 1;
+
+    // Used for spawn positions and directions.
+    std::uint64_t seed = 0;
+};
+
+///
+/// A party mode arena with two paddles and any number of balls.<br><br>
+///
+/// The balls are stored as a struct of arrays sized once by <i>Reserve</i> and reused when balls are removed. Every
+/// step, the balls are counting sorted into a uniform grid whose cells are one ball diameter wide and the arrays are
+/// reordered cell by cell. Each ball is then only tested against the contiguous ranges of its neighbour cells and
+/// paddles only test the balls of the cells they cover. The grid can be built by several threads with the same
+/// results.<br><br>
+///
+/// Since the balls are reordered, an index is only valid until the next step.<br><br>
+///
+/// Balls bounce off walls and paddles like in a match and off each other like equal mass billiard balls. A ball that
+/// reaches a side scores a point for the opposite player and is spawned again near the middle.
+///
+class MultiBallWorld
+{
+public:
+    std::vector<float> ballX;
+    std::vector<float> ballY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+
+    float paddleY[2] = { 0.0f, 0.0f };
+    unsigned long long scores[2] = { 0ull, 0ull };
+
+public:
+    explicit MultiBallWorld(const MultiBallSettings& settings) noexcept;
+    ~MultiBallWorld() noexcept;
+
+    MultiBallWorld(const MultiBallWorld&) = delete;
+    MultiBallWorld& operator=(const MultiBallWorld&) = delete;
+
+public:
+    ///
+    /// Makes room for <i>capacity</i> balls so that adding balls doesn't allocate.
+    ///
+    void Reserve(std::size_t capacity) noexcept;
+
+    ///
+    /// Adds a ball at a random position near the middle, moving in a random direction.
+    ///
+    /// \return The index of the ball.
+    ///
+    std::size_t Spawn() noexcept;
+
+    ///
+    /// Removes a ball. The last ball takes its index.
+    ///
+    void Remove(std::size_t index) noexcept;
+
+    ///
+    /// Moves the paddles and the balls, then handles every contact.
+    ///
+    void Step(float delta, const PaddleAction (&actions)[2]) noexcept;
+
+public:
+    LEPONG_NODISCARD std::size_t Size() const noexcept
+    {
+        return mSize;
+    }
+
+    ///
+    /// \return How many ball pairs were close enough to be tested during the last step.
+    ///
+    LEPONG_NODISCARD unsigned long long GetTestedPairs() const noexcept
+    {
+        return mTestedPairs;
+    }
+
+private:
+    void PlaceBall(std::size_t index) noexcept;
+
+    void MovePaddles(float delta, const PaddleAction (&actions)[2]) noexcept;
+    void MoveBalls(float delta) noexcept;
+
+    void BuildGrid() noexcept;
+    static void CountCells(void* userData, unsigned thread, unsigned threadCount) noexcept;
+    static void ScatterCells(void* userData, unsigned thread, unsigned threadCount) noexcept;
+    static void ReorderBalls(void* userData, unsigned thread, unsigned threadCount) noexcept;
+
+    void CollideBalls() noexcept;
+    void CollideBallWithRange(std::uint32_t ball, std::uint32_t begin, std::uint32_t end) noexcept;
+    void CollidePaddles() noexcept;
+
+    LEPONG_NODISCARD std::uint32_t GetCellX(float x) const noexcept;
+    LEPONG_NODISCARD std::uint32_t GetCellY(float y) const noexcept;
+
+private:
+    MultiBallSettings mSettings;
+    Random mRandom;
+
+    std::size_t mSize = 0;
+
+    float mCellSize = 0.0f;
+    std::uint32_t mGridWidth = 0;
+    std::uint32_t mGridHeight = 0;
+
+    // The cell of each ball, in the new order once reordered.
+    std::vector<std::uint32_t> mBallCells;
+    std::vector<std::uint32_t> mScratchCells;
+
+    // Once reordered, the balls of cell c are [mCellStarts[c], mCellStarts[c + 1]).
+    std::vector<std::uint32_t> mCellStarts;
+
+    // The ball that goes at each index when reordering, in cell then index order.
+    std::vector<std::uint32_t> mCellBalls;
+
+    // Where the balls are reordered to before swapping with the ball arrays.
+    std::vector<float> mScratch[4];
+
+    // Per thread ball counts then write offsets for each cell, one row of cells per thread.
+    std::vector<std::uint32_t> mThreadCells;
+
+    std::unique_ptr<WorkerGroup> mWorkers;
+
+    unsigned long long mTestedPairs = 0;
+};
+
+} // namespace lepong
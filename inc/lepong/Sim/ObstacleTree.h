@@ -0,0 +1,177 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Math/Vector2.h"
+
+namespace lepong
+{
+
+///
+/// An axis aligned box the balls bounce off, like the bricks of Breakout-style arenas.
+///
+struct Obstacle
+{
+    Vector2f center;
+    Vector2f halfSize;
+};
+
+///
+/// The first obstacle found by a sweep, see <i>SweepHit</i>.
+///
+struct ObstacleHit
+{
+    static constexpr std::uint32_t skNone = 0xFFFFFFFFu;
+
+    // The index the obstacle was given to ObstacleTree::Build, skNone if nothing was hit.
+    std::uint32_t obstacle = skNone;
+
+    // The fraction of the motion done before touching, in [0, 1].
+    float time = 1.0f;
+
+    // Points from the obstacle toward the moving circle.
+    Vector2f normal;
+};
+
+///
+/// A bounding volume hierarchy over obstacles that can be removed one by one.<br><br>
+///
+/// The tree is built once, top down, by splitting every node at the median obstacle along the longest axis of its
+/// obstacle centers, so it is balanced and its depth is logarithmic in the obstacle count. The nodes and the obstacles
+/// are stored in depth first order in flat arrays, the obstacles of a leaf being contiguous.<br><br>
+///
+/// Removing an obstacle refits the bounds of its leaf then of the ancestors whose bounds shrink, instead of building
+/// the tree again. The tree keeps its shape, so queries stay logarithmic as obstacles are removed.<br><br>
+///
+/// Queries are exact sweeps of circles against the obstacle boxes, with the rules of <i>SweepCircleAabb</i>. Nodes are
+/// visited nearest first and skipped once a closer hit is known.
+///
+class ObstacleTree
+{
+public:
+    // Obstacles per leaf. A few boxes are cheaper to test than another level of nodes.
+    static constexpr unsigned skLeafSize = 4;
+
+public:
+    ///
+    /// Builds the tree over the obstacles, replacing the previous ones. Every obstacle starts alive.
+    ///
+    void Build(const std::vector<Obstacle>& obstacles) noexcept;
+
+    ///
+    /// Removes an obstacle and refits the bounds that contained it. Removing a removed obstacle does nothing.
+    ///
+    void Remove(std::uint32_t obstacle) noexcept;
+
+    ///
+    /// Brings back every removed obstacle and refits the whole tree.
+    ///
+    void RestoreAll() noexcept;
+
+public:
+    ///
+    /// Sweeps a circle along <i>motion</i> against the obstacles left.
+    ///
+    /// \return Whether the circle touches an obstacle during the motion, in which case <i>hit</i> is the first one.
+    ///
+    LEPONG_NODISCARD bool SweepCircle(const Vector2f& center, float radius, const Vector2f& motion, ObstacleHit& hit) const noexcept;
+
+    ///
+    /// A sweep of a point, the first obstacle crossed by the segment from <i>origin</i> to <i>origin + motion</i>.
+    ///
+    LEPONG_NODISCARD bool Raycast(const Vector2f& origin, const Vector2f& motion, ObstacleHit& hit) const noexcept
+    {
+        return SweepCircle(origin, 0.0f, motion, hit);
+    }
+
+    ///
+    /// Sweeps <i>count</i> circles of the same radius, like the balls of a multi-ball arena, writing the result of
+    /// circle i to <i>hits[i]</i>. The tree isn't changed in between, so hits can be handled after all the sweeps.<br>
+    /// Circles close to each other visit the same nodes, giving them in an order where neighbours are close, like the
+    /// grid order of a <i>MultiBallWorld</i>, keeps those nodes in the cache.
+    ///
+    /// \return The number of circles that hit an obstacle.
+    ///
+    std::size_t SweepCircles(
+        const Vector2f* centers, const Vector2f* motions, std::size_t count, float radius, ObstacleHit* hits) const noexcept;
+
+public:
+    LEPONG_NODISCARD std::size_t Size() const noexcept
+    {
+        return mObstacles.size();
+    }
+
+    LEPONG_NODISCARD std::size_t GetAliveCount() const noexcept
+    {
+        return mAliveCount;
+    }
+
+    LEPONG_NODISCARD bool IsAlive(std::uint32_t obstacle) const noexcept
+    {
+        return mAlive[mSlots[obstacle]] != 0u;
+    }
+
+    LEPONG_NODISCARD const Obstacle& GetObstacle(std::uint32_t obstacle) const noexcept
+    {
+        return mObstacles[mSlots[obstacle]];
+    }
+
+    ///
+    /// \return The number of nodes from the root to the deepest leaf, the root included.
+    ///
+    LEPONG_NODISCARD unsigned GetDepth() const noexcept
+    {
+        return mDepth;
+    }
+
+private:
+    struct Node
+    {
+        // Empty nodes, whose obstacles were all removed, have min > max.
+        Vector2f min;
+        Vector2f max;
+
+        // For leaves, the obstacles [first, first + count) of mObstacles. Otherwise the children are the nodes first and
+        // first + 1 and count is 0.
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;
+    };
+
+private:
+    ///
+    /// Builds the subtree of <i>node</i> over the obstacles <i>mOrder[begin, end)</i>.
+    ///
+    void BuildNode(std::uint32_t node, std::uint32_t begin, std::uint32_t end, const std::vector<Obstacle>& obstacles, unsigned depth) noexcept;
+
+    ///
+    /// Recomputes the bounds of a node from its alive obstacles or from its children.
+    ///
+    /// \return Whether the bounds changed.
+    ///
+    bool RefitNode(std::uint32_t node) noexcept;
+
+private:
+    std::vector<Node> mNodes;
+    std::vector<std::uint32_t> mParents;
+
+    // In leaf order, with whether each one is alive and the leaf it is in.
+    std::vector<Obstacle> mObstacles;
+    std::vector<std::uint8_t> mAlive;
+    std::vector<std::uint32_t> mLeaves;
+
+    // The slot in leaf order of each obstacle index given to Build, and the other way around.
+    std::vector<std::uint32_t> mSlots;
+    std::vector<std::uint32_t> mOrder;
+
+    std::size_t mAliveCount = 0;
+    unsigned mDepth = 0;
+};
+
+} // namespace lepong
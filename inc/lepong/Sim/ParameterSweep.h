@@ -0,0 +1,252 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Sim/MatchBatch.h"
+#include "lepong/Sim/MatchRules.h"
+
+namespace lepong
+{
+
+///
+/// The count, mean, variance, extremes and a histogram of a stream of positive values, in constant memory.<br><br>
+///
+/// The mean and variance are updated with Welford's method and two sets of stats merge exactly, so threads can keep
+/// their own. The histogram has <code>skBucketsPerOctave</code> buckets per power of two, which bounds the relative
+/// error of the quantiles.
+///
+class StreamingStats
+{
+public:
+    static constexpr int skMinExponent = -8;
+    static constexpr int skMaxExponent = 24;
+    static constexpr unsigned skBucketsPerOctave = 8;
+    static constexpr unsigned skBucketCount = (skMaxExponent - skMinExponent) * skBucketsPerOctave;
+
+public:
+    void Add(double value) noexcept;
+
+    ///
+    /// Adds the values <i>other</i> was given, as if they were added to this.
+    ///
+    void Merge(const StreamingStats& other) noexcept;
+
+public:
+    LEPONG_NODISCARD std::uint64_t GetCount() const noexcept
+    {
+        return mCount;
+    }
+
+    LEPONG_NODISCARD double GetMean() const noexcept
+    {
+        return mMean;
+    }
+
+    LEPONG_NODISCARD double GetVariance() const noexcept
+    {
+        return mCount > 1u ? mM2 / static_cast<double>(mCount - 1u) : 0.0;
+    }
+
+    LEPONG_NODISCARD double GetStandardDeviation() const noexcept;
+
+    LEPONG_NODISCARD double GetMin() const noexcept
+    {
+        return mMin;
+    }
+
+    LEPONG_NODISCARD double GetMax() const noexcept
+    {
+        return mMax;
+    }
+
+    ///
+    /// \param q The quantile, in [0, 1].
+    ///
+    /// \return The upper bound of the histogram bucket the quantile falls in, clamped to the extremes.
+    ///
+    LEPONG_NODISCARD double GetQuantile(double q) const noexcept;
+
+private:
+    LEPONG_NODISCARD static unsigned GetBucket(double value) noexcept;
+    LEPONG_NODISCARD static double GetBucketEnd(unsigned bucket) noexcept;
+
+private:
+    std::uint64_t mCount = 0;
+
+    double mMean = 0.0;
+    double mM2 = 0.0;
+    double mMin = 0.0;
+    double mMax = 0.0;
+
+    // Values below 2^skMinExponent go to the first bucket and values above 2^skMaxExponent to the last one.
+    std::uint64_t mBuckets[skBucketCount] = {};
+};
+
+///
+/// The values a parameter takes in a sweep, <i>steps</i> evenly spaced values from <i>min</i> to <i>max</i>.
+///
+struct SweepRange
+{
+    float min = 0.0f;
+    float max = 0.0f;
+    unsigned steps = 1;
+
+public:
+    LEPONG_NODISCARD float Get(unsigned step) const noexcept
+    {
+        return steps > 1u ? min + (max - min) * static_cast<float>(step) / static_cast<float>(steps - 1u) : min;
+    }
+};
+
+struct SweepSettings
+{
+    // One range per field of MatchRules, every combination is a configuration. A single value by default.
+    SweepRange ballSpeed = { Ball::skDefaultMoveSpeed, Ball::skDefaultMoveSpeed };
+    SweepRange paddleSpeed = { Paddle::skDefaultMoveSpeed, Paddle::skDefaultMoveSpeed };
+    SweepRange hitSpeedGain = { 50.0f, 50.0f };
+    SweepRange graceZone = { 0.1f, 0.1f };
+    SweepRange paddleHeight = { Match::skPaddleSize.y, Match::skPaddleSize.y };
+
+    // The matches played with each configuration.
+    unsigned long long matches = 1000;
+    unsigned points = 5;
+
+    // The matches of a configuration are split into chunks of this many matches, each played by one thread with its own
+    // launch streams. The chunks only depend on this and the match count, so neither do the results.
+    unsigned long long chunk = 256;
+
+    // The matches of a chunk are played this many at a time.
+    unsigned lanes = 1024;
+
+    float delta = 1.0f / 240.0f;
+
+    // The TrackBall dead zones of both players. Different dead zones make the win rates say something about how much
+    // the rules reward skill.
+    float deadZones[2] = { 10.0f, 10.0f };
+
+    // Matches with a point that lasts longer than this many seconds are given up and count for nobody.
+    float maxPointTime = 120.0f;
+
+    // 0 uses one thread per hardware thread.
+    unsigned threads = 0;
+
+    std::uint64_t seed = 0;
+    BatchKernel kernel = BatchKernel::Auto;
+};
+
+///
+/// What the matches of a configuration gave.
+///
+struct SweepResult
+{
+    MatchRules rules;
+
+    // Paddle hits per point.
+    StreamingStats rallyLength;
+
+    // Seconds per point.
+    StreamingStats pointTime;
+
+    // The share of the points of each match the first player won.
+    StreamingStats pointShare;
+
+    std::uint64_t matches = 0;
+    std::uint64_t wins[2] = { 0u, 0u };
+
+    // Matches given up because of a point longer than SweepSettings::maxPointTime, they count in no statistic but
+    // the points they finished.
+    std::uint64_t timeouts = 0;
+
+    std::uint64_t ticks = 0;
+
+public:
+    ///
+    /// Adds the matches of <i>other</i>, played with the same rules, as if they were played by this.
+    ///
+    void Merge(const SweepResult& other) noexcept;
+};
+
+///
+/// Plays bot vs bot matches for every combination of rules in a grid and reduces them to streaming statistics.<br><br>
+///
+/// The matches of every configuration are split in chunks. Each thread takes the next chunk and plays its matches on a
+/// <i>MatchBatch</i>, a lane starting a new match as soon as its match ends, so small grids still keep every thread
+/// busy. The thread finishing the last chunk of a configuration merges the chunks in order.<br>
+/// Chunk n of every configuration launches from the same streams of the same seed, so differences between
+/// configurations come from the rules rather than the launches, and the results don't depend on the thread count.
+///
+class ParameterSweep
+{
+public:
+    explicit ParameterSweep(const SweepSettings& settings) noexcept;
+
+public:
+    ///
+    /// Plays every configuration, replacing the results of the previous run.
+    ///
+    void Run() noexcept;
+
+public:
+    ///
+    /// \return The rules of every configuration, the last range varying fastest.
+    ///
+    LEPONG_NODISCARD const std::vector<MatchRules>& GetGrid() const noexcept
+    {
+        return mGrid;
+    }
+
+    ///
+    /// \return One result per configuration of the grid, in the same order.
+    ///
+    LEPONG_NODISCARD const std::vector<SweepResult>& GetResults() const noexcept
+    {
+        return mResults;
+    }
+
+    LEPONG_NODISCARD std::uint64_t GetTickCount() const noexcept;
+
+    LEPONG_NODISCARD unsigned GetThreadCount() const noexcept
+    {
+        return mThreadCount;
+    }
+
+private:
+    static void PlayChunks(void* userData, unsigned thread, unsigned threadCount) noexcept;
+
+    ///
+    /// Plays the matches of a chunk of a configuration.
+    ///
+    void PlayChunk(std::size_t configuration, std::size_t chunk, SweepResult& result) noexcept;
+
+    ///
+    /// Merges the chunks of a configuration into its result, in chunk order so that the sums don't depend on which
+    /// chunk finished first.
+    ///
+    void MergeChunks(std::size_t configuration) noexcept;
+
+private:
+    SweepSettings mSettings;
+    unsigned mThreadCount;
+
+    std::vector<MatchRules> mGrid;
+    std::vector<SweepResult> mResults;
+
+    // The chunks of each configuration, the results of those in play, and how many of them each configuration finished.
+    std::size_t mChunkCount = 1;
+    std::vector<std::unique_ptr<SweepResult>> mChunks;
+    std::vector<std::atomic<std::size_t>> mFinished;
+
+    // The next chunk to play, shared by the threads. Chunk c of configuration i is chunk i * mChunkCount + c.
+    std::atomic<std::size_t> mNext{ 0 };
+};
+
+} // namespace lepong
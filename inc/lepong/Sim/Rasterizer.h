@@ -0,0 +1,45 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lepong/Sim/MatchBatch.h"
+
+namespace lepong
+{
+
+///
+/// Draws matches into small grayscale frames without any graphics API, e.g. as observations for learning agents.<br>
+/// The frames show what the game draws with the whole arena scaled to the frame: a pixel is covered when its center
+/// is, like OpenGL does, the background is 0, the paddles are 255 and the ball is the glow of
+/// <code>MakeBallFragmentShader</code>. The arena, ball and paddle sizes are those of the rules the batch plays with.
+///
+namespace Rasterizer
+{
+
+static constexpr unsigned skFrameWidth = 84;
+static constexpr unsigned skFrameHeight = 84;
+static constexpr std::size_t skFrameSize = skFrameWidth * skFrameHeight;
+
+///
+/// Draws the match at <i>index</i>.
+///
+/// \param frame <code>skFrameSize</code> bytes, row by row from the top of the arena.
+///
+void DrawMatch(const MatchBatch& batch, std::size_t index, std::uint8_t* frame) noexcept;
+
+///
+/// Draws matches [begin, end), shading the ball with SSE2 when the CPU has it. Split the matches between threads to
+/// draw in parallel.
+///
+/// \param frames <code>(end - begin) * skFrameSize</code> bytes.
+///
+void DrawMatches(const MatchBatch& batch, std::size_t begin, std::size_t end, std::uint8_t* frames) noexcept;
+
+} // namespace Rasterizer
+
+} // namespace lepong
@@ -0,0 +1,118 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+
+namespace lepong
+{
+
+///
+/// A recorded match. The simulation is deterministic, so the starting state and the inputs are enough to play the
+/// whole match again, a few hundred bytes instead of a state per tick.<br><br>
+///
+/// Layout, little endian:<br>
+/// - "LPRP", a version byte and a flags byte (bit 0: continuous collision, bits 1-2: player 1 or 2 is a bot)<br>
+/// - The random generator state (8 bytes) and the tick delta (a 4 byte float)<br>
+/// - Events, each one a varint: the number of ticks since the previous event shifted left by 3, the player in bit 2
+/// and the action in bits 0-1. Action 3 of player 0 launches the ball.<br>
+/// - An end event, action 3 of player 1, followed by the hash of the final state (8 bytes)<br><br>
+///
+/// Events apply to the tick they are keyed by, before it's simulated. Paddle events are transitions: a paddle keeps
+/// its action until its next event, so only key presses and releases are stored. Bots have no events: their actions
+/// are a function of the match so they are computed again during playback.
+///
+using Replay = std::vector<std::uint8_t>;
+
+///
+/// Writes a replay as a match is played.
+///
+class ReplayRecorder
+{
+public:
+    ///
+    /// Starts a new replay in <i>replay</i>, the match must not have been played yet.
+    ///
+    /// \param bots Bit i is set when player i is a <i>TrackBall</i> bot with the default dead zone.
+    ///
+    void Begin(const Match& match, float delta, Replay& replay, unsigned bots = 0) noexcept;
+
+    ///
+    /// Records a launch before the current tick.
+    ///
+    void Launch() noexcept;
+
+    ///
+    /// Records the actions of the current tick and moves to the next one. The actions of bots are ignored.
+    ///
+    void Tick(const PaddleAction (&actions)[2]) noexcept;
+
+    ///
+    /// Ends the replay with the hash of the state the match ended in.
+    ///
+    void End(const Match& match) noexcept;
+
+public:
+    LEPONG_NODISCARD std::uint64_t GetTick() const noexcept
+    {
+        return mTick;
+    }
+
+private:
+    void WriteEvent(unsigned player, unsigned action) noexcept;
+
+private:
+    Replay* mReplay = nullptr;
+
+    std::uint64_t mTick = 0;
+    std::uint64_t mLastEventTick = 0;
+    unsigned mBots = 0;
+
+    PaddleAction mActions[2] = { PaddleAction::Stay, PaddleAction::Stay };
+};
+
+enum class ReplayStatus
+{
+    Ok,
+    Malformed,
+
+    // The replay played fine but didn't end in the recorded state, the simulation changed since it was recorded.
+    Desync
+};
+
+struct ReplayInfo
+{
+    std::uint64_t ticks = 0;
+    std::uint64_t events = 0;
+    std::uint64_t hash = 0;
+};
+
+///
+/// Plays a replay again from the start.
+///
+/// \param match Set to the state the replay ends in.
+///
+ReplayStatus PlayReplay(const Replay& replay, Match& match, ReplayInfo* info = nullptr) noexcept;
+
+///
+/// \return Whether the replay could be written to the file.
+///
+bool SaveReplay(const Replay& replay, const char* path) noexcept;
+
+///
+/// \return Whether the file could be read, in which case its contents are in <i>replay</i>.
+///
+bool LoadReplay(const char* path, Replay& replay) noexcept;
+
+///
+/// \return The action that would leave the paddle in its current state, e.g. to record keyboard input.
+///
+LEPONG_NODISCARD PaddleAction GetPaddleAction(const Paddle& paddle) noexcept;
+
+} // namespace lepong
@@ -0,0 +1,83 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Math/Fixed.h"
+
+namespace lepong
+{
+
+///
+/// A match stepped with the discrete rules of <i>Match::Update</i>, with every number stored as <i>Scalar</i>.<br><br>
+///
+/// With <code>float</code>, the results are bit-for-bit those of <i>Match</i>. With <i>Fixed</i>, the whole step,
+/// collisions and square roots included, only uses integers so the results don't depend on the compiler or the CPU,
+/// which is what replays and lockstep need.<br><br>
+///
+/// Instantiated for <code>float</code> and <i>Fixed</i> only.
+///
+template<typename Scalar>
+class ScalarMatch
+{
+public:
+    using Vector = Vector2<Scalar>;
+
+public:
+    Vector ballPosition;
+    Vector ballDirection;
+    Scalar ballSpeed = 0;
+
+    // The paddles only move vertically.
+    Scalar paddleY[2];
+    Scalar paddleDirection[2];
+    Scalar paddleSpeed[2];
+
+    unsigned scores[2] = { 0u, 0u };
+    bool playing = false;
+
+    Random random;
+
+public:
+    ///
+    /// Creates a match in the same state as a new <i>Match</i>.
+    ///
+    ScalarMatch() noexcept;
+
+public:
+    ///
+    /// Copies the state of <i>match</i>, rounding every number to <i>Scalar</i>.
+    ///
+    void Load(const Match& match) noexcept;
+
+    void Store(Match& match) const noexcept;
+
+public:
+    ///
+    /// Same as <i>Match::Reset</i>.
+    ///
+    void Reset() noexcept;
+
+    ///
+    /// Same as <i>Match::Launch</i>.
+    ///
+    void Launch() noexcept;
+
+    ///
+    /// Applies the actions to the paddles then advances the match like <i>Match::Update</i> does without continuous
+    /// collision.
+    ///
+    /// \return The side that lost the point during this update or <code>Side::None</code>.
+    ///
+    Side Update(Scalar delta, const PaddleAction (&actions)[2]) noexcept;
+
+    ///
+    /// Same as <i>TrackBall</i> for the provided player.
+    ///
+    LEPONG_NODISCARD PaddleAction TrackBall(unsigned player, Scalar deadZone = 10) const noexcept;
+};
+
+} // namespace lepong
@@ -0,0 +1,112 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+
+namespace lepong
+{
+
+static_assert(std::is_trivially_copyable_v<Match>, "Snapshots copy matches with memcpy");
+
+///
+/// A match at a given tick. Trivially copyable, saving or restoring the match is a single memcpy.
+///
+struct GameState
+{
+    static constexpr std::uint64_t skNoTick = ~std::uint64_t{ 0 };
+
+    std::uint64_t tick = skNoTick;
+    Match match;
+};
+
+static_assert(std::is_trivially_copyable_v<GameState>, "Game states must be copyable with memcpy");
+
+inline void SaveState(std::uint64_t tick, const Match& match, GameState& state) noexcept
+{
+    state.tick = tick;
+    std::memcpy(&state.match, &match, sizeof(Match));
+}
+
+inline void RestoreState(const GameState& state, Match& match) noexcept
+{
+    std::memcpy(&match, &state.match, sizeof(Match));
+}
+
+///
+/// Hashes everything that changes while a match is played (FNV-1a over the bits of the values, padding excluded), so
+/// two matches have the same hash when they would play the same from now on.<br>
+/// Replay files store this hash. Checks that run every tick should use <i>Match::GetStateHash</i>, which is kept up to
+/// date as the match changes instead of being computed from every byte.
+///
+LEPONG_NODISCARD std::uint64_t HashState(const Match& match) noexcept;
+
+///
+/// The states of the last ticks, allocated once. Tick t goes in slot <code>t % Capacity()</code> and overwrites the
+/// state that was there.
+///
+class SnapshotRing
+{
+public:
+    ///
+    /// \param capacity The number of states kept, rounded up to a power of two.
+    ///
+    explicit SnapshotRing(std::size_t capacity) noexcept;
+
+public:
+    void Save(std::uint64_t tick, const Match& match) noexcept
+    {
+        SaveState(tick, match, mStates[tick & mMask]);
+    }
+
+    ///
+    /// \return Whether the state of <i>tick</i> was still in the ring, in which case <i>match</i> is set to it.
+    ///
+    bool Restore(std::uint64_t tick, Match& match) const noexcept
+    {
+        const auto* state = Find(tick);
+
+        if (!state)
+        {
+            return false;
+        }
+
+        RestoreState(*state, match);
+        return true;
+    }
+
+    ///
+    /// \return The state of <i>tick</i> or <code>nullptr</code> if it was overwritten or never saved.
+    ///
+    LEPONG_NODISCARD const GameState* Find(std::uint64_t tick) const noexcept
+    {
+        const auto& kState = mStates[tick & mMask];
+        return kState.tick == tick ? &kState : nullptr;
+    }
+
+    ///
+    /// Forgets every state.
+    ///
+    void Clear() noexcept;
+
+public:
+    LEPONG_NODISCARD std::size_t Capacity() const noexcept
+    {
+        return mStates.size();
+    }
+
+private:
+    std::vector<GameState> mStates;
+    std::size_t mMask = 0;
+};
+
+} // namespace lepong
@@ -0,0 +1,141 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+
+namespace lepong
+{
+
+///
+/// A recorded match that can be scrubbed through: every <i>keyframeInterval</i> ticks the whole match is stored, and
+/// every tick in between stores what changed it, so any tick is the nearest keyframe plus a few ticks of
+/// simulation.<br><br>
+///
+/// Layout, in the byte order of the machine that recorded it:<br>
+/// - "LPTL", a version byte, 3 padding bytes, <code>sizeof(Match)</code> (u32), the keyframe interval (u32) and the
+/// tick delta (float)<br>
+/// - One chunk per keyframe: the match at the start of the keyframe tick, then a byte per tick of the chunk with the
+/// action of player 1 in bits 0-1, the action of player 2 in bits 2-3 and whether the ball was launched before the
+/// tick in bit 4<br>
+/// - The index: the offset of every chunk (u64), then the keyframe count (u64), the tick count (u64), the offset of
+/// the index (u64) and "LPTI"<br><br>
+///
+/// Matches are stored as they are in memory, a timeline can only be read by builds with the same <i>Match</i>.
+/// This writes one as a match is played.
+///
+class TimelineWriter
+{
+public:
+    // A second at the game's tick rate.
+    static constexpr unsigned skDefaultKeyframeInterval = 240;
+
+public:
+    TimelineWriter() noexcept = default;
+    ~TimelineWriter() noexcept;
+
+    TimelineWriter(const TimelineWriter&) = delete;
+    TimelineWriter& operator=(const TimelineWriter&) = delete;
+
+public:
+    ///
+    /// \return Whether the file could be created.
+    ///
+    bool Open(const char* path, float delta, unsigned keyframeInterval = skDefaultKeyframeInterval) noexcept;
+
+    ///
+    /// Records a tick, call before the match is updated.
+    ///
+    /// \param match The match at the start of the tick, after the launch if the ball was just launched.
+    /// \param launched Whether the ball was launched since the previous tick.
+    /// \param actions The actions applied to the paddles during the tick.
+    ///
+    void Record(const Match& match, bool launched, const PaddleAction (&actions)[2]) noexcept;
+
+    ///
+    /// Writes the index and closes the file.
+    ///
+    /// \return Whether everything was written.
+    ///
+    bool Close() noexcept;
+
+private:
+    void Write(const void* data, std::size_t size) noexcept;
+
+private:
+    std::FILE* mFile = nullptr;
+    bool mFailed = false;
+
+    unsigned mKeyframeInterval = 0;
+    std::uint64_t mTicks = 0;
+    std::uint64_t mOffset = 0;
+
+    std::vector<std::uint64_t> mIndex;
+};
+
+///
+/// Reads a timeline file, mapped in memory so that seeking only touches the pages of one chunk.
+///
+class TimelineReader
+{
+public:
+    TimelineReader() noexcept = default;
+    ~TimelineReader() noexcept;
+
+    TimelineReader(const TimelineReader&) = delete;
+    TimelineReader& operator=(const TimelineReader&) = delete;
+
+public:
+    ///
+    /// \return Whether the file could be mapped and is a valid timeline.
+    ///
+    bool Open(const char* path) noexcept;
+    void Close() noexcept;
+
+    ///
+    /// Restores the nearest keyframe before <i>tick</i> and simulates the ticks up to it.
+    ///
+    /// \return Whether the tick was recorded, in which case <i>match</i> is set to the match at its start. Its contact
+    /// buffer is kept and gets no contact from the simulated ticks.
+    ///
+    bool Seek(std::uint64_t tick, Match& match) const noexcept;
+
+public:
+    LEPONG_NODISCARD std::uint64_t GetTickCount() const noexcept
+    {
+        return mTicks;
+    }
+
+    LEPONG_NODISCARD unsigned GetKeyframeInterval() const noexcept
+    {
+        return mKeyframeInterval;
+    }
+
+    LEPONG_NODISCARD float GetDelta() const noexcept
+    {
+        return mDelta;
+    }
+
+private:
+    const std::uint8_t* mData = nullptr;
+    std::size_t mSize = 0;
+
+    // The file mapping on Windows, unused elsewhere.
+    void* mMapping = nullptr;
+
+    unsigned mKeyframeInterval = 0;
+    float mDelta = 0.0f;
+    std::uint64_t mTicks = 0;
+    std::uint64_t mKeyframes = 0;
+    const std::uint8_t* mIndex = nullptr;
+};
+
+} // namespace lepong
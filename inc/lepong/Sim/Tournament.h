@@ -0,0 +1,206 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Sim/MatchFarm.h"
+
+namespace lepong
+{
+
+///
+/// Decides what a paddle does every tick. Called from the farm threads, so <i>userData</i> must be safe to read
+/// concurrently.
+///
+using PFNTickController = PaddleAction (*)(const Match& match, unsigned player, void* userData);
+
+struct TournamentPlayer
+{
+    std::string name;
+
+    PFNTickController function = nullptr;
+    void* userData = nullptr;
+};
+
+///
+/// How a tournament bot plays, see <i>PlayBotStyle</i>.
+///
+struct BotStyle
+{
+    // The paddle stays still while its target is within this many pixels of its center.
+    float deadZone = 10.0f;
+
+    // Where the paddle meets the ball, from its center in half paddle heights. The ball bounces away from the paddle
+    // center, so hitting it off-center sends it at a steeper angle.
+    float aim = 0.0f;
+
+    // Moves to where the ball will cross the paddle instead of following its height, and back to the middle when the
+    // ball goes away.
+    bool predict = false;
+};
+
+///
+/// \param userData A <i>BotStyle</i>.
+///
+LEPONG_NODISCARD PaddleAction PlayBotStyle(const Match& match, unsigned player, void* userData) noexcept;
+
+///
+/// A skill estimate, kept both as an Elo rating and as a TrueSkill mean and deviation.
+///
+struct Rating
+{
+    double elo = 1500.0;
+
+    double mu = 25.0;
+    double sigma = 25.0 / 3.0;
+
+    ///
+    /// \return The TrueSkill rating the player is almost surely above, which is what players are ranked by.
+    ///
+    LEPONG_NODISCARD double GetConservative() const noexcept
+    {
+        return mu - 3.0 * sigma;
+    }
+};
+
+///
+/// Updates the ratings of two players after a match.
+///
+/// \param score 1 if the first player won, 0 if it lost and 0.5 for a draw. TrueSkill ignores draws.
+///
+void UpdateRatings(Rating& first, Rating& second, double score, double eloK) noexcept;
+
+///
+/// The matches played between two players. The first player plays on the left in even matches.
+///
+struct PairResult
+{
+    std::uint32_t players[2] = { 0u, 0u };
+    std::uint32_t games = 0;
+
+    // Matches that end by hitting the tick limit count for nobody.
+    std::uint32_t wins[2] = { 0u, 0u };
+
+    std::uint64_t points[2] = { 0u, 0u };
+    std::uint64_t ticks = 0;
+};
+
+struct TournamentSettings
+{
+    enum class Pairing
+    {
+        // Every player meets every other player.
+        RoundRobin,
+
+        // Every round pairs players of similar ratings who haven't met yet.
+        Swiss
+    } pairing = Pairing::RoundRobin;
+
+    // Swiss rounds, unused for round robins.
+    unsigned rounds = 7;
+
+    // The matches played by each pair, the players switching sides every match.
+    unsigned games = 100;
+
+    unsigned points = 5;
+    float delta = 1.0f / 240.0f;
+    unsigned long long maxTicks = BotMatchSettings{}.maxTicks;
+
+    double eloK = 16.0;
+
+    // The farm the matches are played on.
+    MatchFarmSettings farm;
+};
+
+///
+/// Plays matches between players on a MatchFarm and rates the players.<br><br>
+///
+/// The tournament is played in rounds where each player meets at most one opponent, so that a round keeps every
+/// thread busy while the ratings are updated between rounds, one match at a time in the order they were scheduled.
+/// Matches are seeded from their index in the whole tournament, so the results don't depend on the thread count.
+///
+class Tournament
+{
+public:
+    explicit Tournament(const TournamentSettings& settings) noexcept;
+
+public:
+    ///
+    /// Plays the whole tournament, replacing the results of the previous one.
+    ///
+    void Run(const std::vector<TournamentPlayer>& players) noexcept;
+
+    ///
+    /// Writes the players, their ratings and the pair results to a file, see Tournament.cpp for the layout.
+    ///
+    /// \return Whether the whole file could be written.
+    ///
+    bool Save(const char* path) const noexcept;
+
+public:
+    LEPONG_NODISCARD const std::vector<Rating>& GetRatings() const noexcept
+    {
+        return mRatings;
+    }
+
+    LEPONG_NODISCARD const std::vector<PairResult>& GetPairs() const noexcept
+    {
+        return mPairs;
+    }
+
+    LEPONG_NODISCARD std::uint64_t GetMatchCount() const noexcept
+    {
+        return mMatches;
+    }
+
+    LEPONG_NODISCARD std::uint64_t GetTickCount() const noexcept
+    {
+        return mTicks;
+    }
+
+    LEPONG_NODISCARD unsigned GetThreadCount() const noexcept
+    {
+        return mFarm.GetThreadCount();
+    }
+
+private:
+    ///
+    /// Plays the matches of the pairs in <i>round</i>, indices into <i>mPairs</i>, and updates the ratings.
+    ///
+    void PlayRound(const std::vector<std::size_t>& round) noexcept;
+
+    ///
+    /// \return The pairs of the next Swiss round.
+    ///
+    LEPONG_NODISCARD std::vector<std::size_t> PairSwissRound() noexcept;
+
+    static void PlayMatch(Match& match, std::size_t index, MatchResult& result, void* userData) noexcept;
+
+private:
+    TournamentSettings mSettings;
+    MatchFarm mFarm;
+
+    // Only set during a run, the names are kept for saving.
+    const std::vector<TournamentPlayer>* mPlayers = nullptr;
+    std::vector<std::string> mNames;
+
+    std::vector<Rating> mRatings;
+    std::vector<PairResult> mPairs;
+
+    // The pairs of the round being played, which play the matches [i * games, (i + 1) * games) of the round.
+    std::vector<std::size_t> mRoundPairs;
+    std::vector<MatchResult> mRoundResults;
+
+    std::uint64_t mMatches = 0;
+    std::uint64_t mTicks = 0;
+};
+
+} // namespace lepong
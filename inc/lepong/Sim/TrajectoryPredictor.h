@@ -0,0 +1,167 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/Match.h"
+
+namespace lepong
+{
+
+///
+/// Where and when a ball reaches a vertical plane.
+///
+struct Intercept
+{
+    float y = 0.0f;
+
+    // From the position the prediction was made at, in seconds.
+    float time = 0.0f;
+};
+
+///
+/// Predicts where a ball moving in a straight line crosses the vertical plane at <i>planeX</i>, bouncing off the
+/// walls like <i>Ball::CollideWithTerrain</i> does. The walls are unfolded: the ball moves in a straight line through
+/// mirrored copies of the terrain, so the crossing is found in closed form instead of by stepping the ball.
+///
+/// \param minY The lowest the ball center goes, usually the radius.
+/// \param maxY The highest the ball center goes, usually the arena height minus the radius.
+///
+/// \return Whether the ball moves toward the plane, in which case <i>intercept</i> is set.
+///
+bool PredictIntercept(
+    const Vector2f& position, const Vector2f& velocity, float planeX, float minY, float maxY, Intercept& intercept) noexcept;
+
+///
+/// Predicts intercepts for many balls, caching the crossing of each ball with the last planes it was asked about.<br>
+/// <br>
+///
+/// Bouncing off a wall only flips the sign of the vertical velocity, so a crossing stays valid from one bounce to the
+/// next: a cached crossing is only computed again when the horizontal velocity or the vertical speed of the ball
+/// changes, which is a paddle or ball collision, or when the ball goes back along its line, which is a reset. Past
+/// the first query of a path, a query is a few comparisons and a division for the time.
+///
+class TrajectoryPredictor
+{
+public:
+    // The planes cached per ball, enough for both paddles.
+    static constexpr unsigned skCachedPlanes = 2;
+
+public:
+    ///
+    /// \param minY The lowest the ball centers go.
+    /// \param maxY The highest the ball centers go.
+    ///
+    TrajectoryPredictor(float minY, float maxY) noexcept;
+
+    ///
+    /// A predictor for the ball of a <i>Match</i>.
+    ///
+    TrajectoryPredictor() noexcept;
+
+public:
+    ///
+    /// Sets the number of balls, which are identified by their index. New balls have nothing cached.
+    ///
+    void Resize(std::size_t balls) noexcept;
+
+    ///
+    /// Forgets what is cached for a ball, e.g. when the index is reused for another ball.
+    ///
+    void Invalidate(std::size_t ball) noexcept;
+
+    ///
+    /// Same as the free <i>PredictIntercept</i>, using what is cached for <i>ball</i> when its path didn't change.
+    ///
+    bool Predict(std::size_t ball, const Vector2f& position, const Vector2f& velocity, float planeX, Intercept& intercept) noexcept
+    {
+        auto& entry = mEntries[ball];
+
+        const auto kSameVelocity = entry.velocityX == velocity.x && entry.speedY == std::fabs(velocity.y);
+        const auto kForward = velocity.x > 0.0f ? position.x >= entry.lastX : position.x <= entry.lastX;
+
+        if (kSameVelocity && kForward)
+        {
+            // Inlined since this is what almost every query ends up doing.
+            const auto kTime = (planeX - position.x) * entry.inverseVelocityX;
+
+            if (kTime < 0.0f)
+            {
+                return false;
+            }
+
+            for (auto i = 0u; i < entry.planes; ++i)
+            {
+                if (entry.planeX[i] == planeX)
+                {
+                    ++mHits;
+
+                    entry.lastX = position.x;
+                    intercept.y = entry.y[i];
+                    intercept.time = kTime;
+
+                    return true;
+                }
+            }
+        }
+
+        return PredictMiss(entry, position, velocity, planeX, intercept);
+    }
+
+    ///
+    /// Predicts where the ball of a match crosses the front plane of a paddle, the plane its center reaches when it
+    /// touches the paddle.
+    ///
+    bool PredictPaddle(std::size_t ball, const Match& match, unsigned player, Intercept& intercept) noexcept;
+
+public:
+    LEPONG_NODISCARD unsigned long long GetHits() const noexcept
+    {
+        return mHits;
+    }
+
+    LEPONG_NODISCARD unsigned long long GetMisses() const noexcept
+    {
+        return mMisses;
+    }
+
+private:
+    struct Entry
+    {
+        // What identifies the path.
+        float velocityX = 0.0f;
+        float speedY = -1.0f;
+
+        // The ball only moves forward along its path, a position behind this one is a new path.
+        float lastX = 0.0f;
+
+        // Times are a multiplication instead of a division.
+        float inverseVelocityX = 0.0f;
+
+        float planeX[skCachedPlanes] = {};
+        float y[skCachedPlanes] = {};
+
+        unsigned planes = 0;
+        unsigned nextPlane = 0;
+    };
+
+    bool PredictMiss(Entry& entry, const Vector2f& position, const Vector2f& velocity, float planeX, Intercept& intercept) noexcept;
+
+private:
+    float mMinY;
+    float mMaxY;
+
+    std::vector<Entry> mEntries;
+
+    unsigned long long mHits = 0;
+    unsigned long long mMisses = 0;
+};
+
+} // namespace lepong
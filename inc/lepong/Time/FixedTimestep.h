@@ -0,0 +1,65 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Attribute.h"
+
+namespace lepong::Time
+{
+
+///
+/// Turns variable frame deltas into a whole number of fixed length ticks.<br><br>
+///
+/// Frame time is accumulated and consumed one tick at a time, the leftover is carried to the next frame and can be
+/// used to interpolate between the last two ticks when rendering. Running the simulation with a constant delta
+/// keeps its results independent from the frame rate.
+///
+class FixedTimestep
+{
+public:
+    ///
+    /// \param tickRate The number of ticks per second.
+    /// \param maxTicksPerFrame The maximum number of ticks a single frame can catch up on.<br>
+    /// Time past that is dropped so that a long hitch slows the game down instead of freezing it.
+    ///
+    constexpr FixedTimestep(unsigned tickRate, unsigned maxTicksPerFrame) noexcept
+        : mTickDelta(1.0f / static_cast<float>(tickRate))
+        , mMaxTicksPerFrame(maxTicksPerFrame)
+    {
+    }
+
+public:
+    ///
+    /// Adds the frame's duration to the accumulated time.
+    ///
+    /// \return The number of ticks to run this frame.
+    ///
+    LEPONG_NODISCARD unsigned Advance(float frameDelta) noexcept;
+
+public:
+    ///
+    /// \return The delta to pass to every tick, in seconds.
+    ///
+    LEPONG_NODISCARD constexpr float GetTickDelta() const noexcept
+    {
+        return mTickDelta;
+    }
+
+    ///
+    /// \return How far the current time is between the last tick and the next one, in [0, 1).
+    ///
+    LEPONG_NODISCARD constexpr float GetAlpha() const noexcept
+    {
+        return mAccumulator / mTickDelta;
+    }
+
+private:
+    float mTickDelta;
+    unsigned mMaxTicksPerFrame;
+
+    float mAccumulator = 0.0f;
+};
+
+} // namespace lepong::Time
@@ -0,0 +1,164 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+// A vectorized reinforcement learning environment with a C interface, so that it can be loaded from Python (ctypes,
+// cffi) or any other language.
+//
+// Every environment is a match where the agent plays the left paddle against a TrackBall bot. An episode is one
+// point: when the ball reaches a side, the environment reports the reward and the end of the episode, then starts a
+// new one on its own. Observations, rewards and episode ends are written to buffers owned by the caller and nothing
+// is allocated after creation.
+//
+// The environments can also run in another process: a server started with lepong_vecenv_serve shares its buffers
+// through shared memory, and lepong_vecenv_connect returns environments whose steps are forwarded to it.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(LEPONG_VECENV_BUILD)
+#define LEPONG_VECENV_API __declspec(dllexport)
+#else
+#define LEPONG_VECENV_API __declspec(dllimport)
+#endif
+#else
+#define LEPONG_VECENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+///
+/// What the environments observe.<br><br>
+///
+/// Vector observations are <code>LEPONG_VECENV_VECTOR_SIZE</code> floats per environment: the ball position (x and
+/// y in [-1, 1]), the ball velocity (in arena widths per second, about [-1, 1]) and the height of the agent and the
+/// opponent paddles (in [-1, 1]).<br><br>
+///
+/// Pixel observations are <code>LEPONG_VECENV_PIXELS_WIDTH * LEPONG_VECENV_PIXELS_HEIGHT</code> bytes per
+/// environment: a grayscale frame of the whole arena, row by row from the top. The background is 0 and the paddles
+/// are 255. The ball glows like in the game: a pixel at distance d from its center, in ball radii, is
+/// <code>255 * (1 - d^6)</code>, rounded and clamped to [0, 255], so it goes from 255 at the center to 0 at its edge.
+///
+typedef enum LepongObservation
+{
+    LEPONG_OBSERVATION_VECTOR = 0,
+    LEPONG_OBSERVATION_PIXELS = 1
+} LepongObservation;
+
+#define LEPONG_VECENV_VECTOR_SIZE 6
+#define LEPONG_VECENV_PIXELS_WIDTH 84
+#define LEPONG_VECENV_PIXELS_HEIGHT 84
+
+///
+/// The actions, one <code>int32_t</code> per environment. Anything else is taken as <code>LEPONG_ACTION_STAY</code>.
+///
+typedef enum LepongAction
+{
+    LEPONG_ACTION_STAY = 0,
+    LEPONG_ACTION_UP = 1,
+    LEPONG_ACTION_DOWN = 2
+} LepongAction;
+
+typedef struct LepongVecEnvSettings
+{
+    uint32_t envCount;
+
+    // The launch directions of every environment come from this.
+    uint64_t seed;
+
+    // The action is repeated for this many ticks per step, the rewards of the ticks are added up.
+    uint32_t frameSkip;
+
+    LepongObservation observation;
+
+    // In seconds.
+    float tickDelta;
+
+    // The pixel observations are drawn by this many threads, including the calling thread.
+    uint32_t threadCount;
+} LepongVecEnvSettings;
+
+typedef struct LepongVecEnv LepongVecEnv;
+
+///
+/// Fills the settings with the defaults: 1 environment, seed 0, a frame skip of 4, vector observations, 240 ticks per
+/// second and 1 thread.
+///
+LEPONG_VECENV_API void lepong_vecenv_default_settings(LepongVecEnvSettings* settings);
+
+///
+/// Creates <i>envCount</i> environments with the default settings.
+///
+/// \return The environments or <code>NULL</code> on failure.
+///
+LEPONG_VECENV_API LepongVecEnv* lepong_vecenv_create(uint32_t envCount, uint64_t seed);
+
+///
+/// \return The environments or <code>NULL</code> if the settings are invalid or on failure.
+///
+LEPONG_VECENV_API LepongVecEnv* lepong_vecenv_create_with_settings(const LepongVecEnvSettings* settings);
+
+LEPONG_VECENV_API void lepong_vecenv_destroy(LepongVecEnv* env);
+
+LEPONG_VECENV_API uint32_t lepong_vecenv_get_env_count(const LepongVecEnv* env);
+
+///
+/// \return The size of the observation of one environment, in bytes.
+///
+LEPONG_VECENV_API size_t lepong_vecenv_get_observation_size(const LepongVecEnv* env);
+
+///
+/// Starts a new episode in every environment and writes the first observations.
+///
+/// \return 0 on success, -1 if a pointer is <code>NULL</code>.
+///
+LEPONG_VECENV_API int lepong_vecenv_reset(LepongVecEnv* env, void* observations);
+
+///
+/// Plays <i>frameSkip</i> ticks in every environment with the provided actions.
+///
+/// \param actions <i>envCount</i> <code>int32_t</code>.
+/// \param observations <i>envCount</i> observations. An environment whose episode ended gets the first observation of
+/// its next episode.
+/// \param rewards <i>envCount</i> floats: 1 when the agent scored, -1 when the opponent did, 0 otherwise.
+/// \param dones <i>envCount</i> bytes, 1 when the episode ended during the step.
+///
+/// \return 0 on success, -1 if a pointer is <code>NULL</code>.
+///
+LEPONG_VECENV_API int lepong_vecenv_step(
+    LepongVecEnv* env, const int32_t* actions, void* observations, float* rewards, uint8_t* dones);
+
+///
+/// How both ends of a connection wait for each other. See <code>lepong::Net::StepWait</code>.
+///
+typedef enum LepongWait
+{
+    LEPONG_WAIT_FUTEX = 0,
+    LEPONG_WAIT_POLL = 1
+} LepongWait;
+
+///
+/// Creates environments with <i>settings</i> and runs them for the trainer that connects to <i>name</i>, until it
+/// destroys its environments.
+///
+/// \return 0 once the trainer is gone, -1 if the settings are invalid or the shared memory couldn't be created.
+///
+LEPONG_VECENV_API int lepong_vecenv_serve(const char* name, const LepongVecEnvSettings* settings, LepongWait wait);
+
+///
+/// Connects to the server running at <i>name</i>. The returned environments take the settings of the server and
+/// are used like local ones, destroying them stops the server.
+///
+/// \return The environments or <code>NULL</code> if there is no server at <i>name</i>.
+///
+LEPONG_VECENV_API LepongVecEnv* lepong_vecenv_connect(const char* name, LepongWait wait);
+
+#ifdef __cplusplus
+}
+#endif
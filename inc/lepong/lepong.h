@@ -10,6 +10,12 @@
 namespace lepong
 {
 
+///
+/// Sets whether the next runs are recorded. A recorded run is saved to <code>lepong.lprp</code> and
+/// <code>lepong.lptl</code> in the working directory, replacing the previous ones. Off by default.
+///
+void SetRecording(bool record) noexcept;
+
 ///
 /// Initializes the game and all of its systems.<br>
 /// If the game is already initialized, this function returns false.
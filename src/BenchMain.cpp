@@ -0,0 +1,1314 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+// Micro benchmarks for the simulation.
+//
+// Usage: lepong_bench entities
+//        lepong_bench balls [COUNT] [THREADS]
+//        lepong_bench snapshot
+//        lepong_bench timeline [INTERVAL]
+//        lepong_bench random
+//        lepong_bench predict
+//        lepong_bench vecenv [ENVS] [FRAMESKIP] [THREADS]
+//        lepong_bench channel [ENVS]
+//        lepong_bench rules [MATCHES]
+//        lepong_bench contacts
+//        lepong_bench hash
+//        lepong_bench bricks [BALLS]
+//
+// entities: moves balls and bounces them off the terrain with Ball objects, each allocated on its own like scene
+// objects are, then with the Ecs registry systems, for 10, 1k and 100k entities.
+//
+// balls: steps a MultiBallWorld with COUNT balls (100k by default) for 10 simulated seconds at 240 Hz, building the
+// grid with THREADS threads (1 by default).
+//
+// snapshot: saves a playing match into a SnapshotRing every tick, then does it again while also restoring the state of
+// 8 ticks before like a rollback does. The restore time is the difference.
+//
+// timeline: records an hour long bot match at 240 Hz to a timeline file with a keyframe every INTERVAL ticks (240 by
+// default), then times seeking to random ticks in the mapped file and checks the seeks against the recorded states.
+//
+// random: times getting random floats from rand() and from each generator of Random.h, one at a time and filled in
+// batches.
+//
+// predict: plays 1024 bot matches and asks where each ball crosses both paddle planes 4 times per tick, by stepping a
+// copy of the ball, with the closed form and with a TrajectoryPredictor. The stepped crossings are the reference for
+// the error.
+//
+// vecenv: steps ENVS learning environments (4096 by default) with random actions and a frame skip of FRAMESKIP (4 by
+// default) through the C interface, with vector then pixel observations drawn by THREADS threads (1 by default), and
+// counts the episodes and rewards.
+//
+// channel: steps ENVS learning environments (1024 by default) in this thread, then through a StepChannel from a
+// server running on another thread, waiting with futexes then by polling. The difference is the cost of the channel.
+//
+// rules: steps a MatchBatch of MATCHES bot matches (1024 by default) with every batch kernel, compiled for the game's
+// rules then reading the same rules at runtime like parameter sweeps do, and checks that both end in the same state.
+//
+// contacts: plays a bot match for 10M ticks without then with a ContactBuffer, with discrete then continuous
+// collision, counts the contacts of each type and checks that recording them doesn't change the match.
+//
+// hash: plays a bot match for 10M ticks and hashes its state every tick with the incrementally maintained hash, the
+// same hash computed from every field and the byte by byte hash of replays. The time without hashing is subtracted.
+// Then checks that the incremental hash is up to date after every tick and every fast forwarded point.
+//
+// bricks: builds an ObstacleTree over a wall of 100 to 100k bricks of the same size between the paddles and sweeps
+// BALLS balls (1024 by default) one tick ahead against them, one at a time, as a batch and by testing every brick,
+// then casts rays from the left paddle. Then plays 10 seconds of Breakout where every brick hit is removed, refitting
+// the tree, and compares a removal to building the tree again.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lepong/Ecs/Systems.h"
+#include "lepong/Game/Bot.h"
+#include "lepong/Game/Contact.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Math/Collision.h"
+#include "lepong/Math/Random.h"
+#include "lepong/Sim/FastForward.h"
+#include "lepong/Sim/MatchBatch.h"
+#include "lepong/Sim/MultiBallWorld.h"
+#include "lepong/Sim/ObstacleTree.h"
+#include "lepong/Sim/Snapshot.h"
+#include "lepong/Sim/Timeline.h"
+#include "lepong/Sim/TrajectoryPredictor.h"
+#include "lepong/VecEnv.h"
+
+namespace
+{
+
+// Every size does about this many entity updates so the timings are comparable.
+constexpr unsigned long long skEntityUpdates = 50'000'000ull;
+
+constexpr float skDelta = 1.0f / 240.0f;
+
+///
+/// \return The time it takes to call <i>function</i>, in seconds.
+///
+template<typename Function>
+double Time(Function function) noexcept
+{
+    const auto kStart = std::chrono::steady_clock::now();
+    function();
+    const auto kEnd = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(kEnd - kStart).count();
+}
+
+///
+/// \return A position and a direction spread over the arena for entity i.
+///
+void GetStartingMotion(std::size_t i, lepong::Vector2f& position, lepong::Vector2f& direction) noexcept
+{
+    const auto kArenaWidth = static_cast<float>(lepong::Match::skArenaSize.x);
+    const auto kArenaHeight = static_cast<float>(lepong::Match::skArenaSize.y);
+
+    position = { static_cast<float>(i * 37 % 1000) / 1000.0f * kArenaWidth, static_cast<float>(i * 91 % 1000) / 1000.0f * kArenaHeight };
+    direction = lepong::Normalize({ (i & 1u) ? 1.0f : -1.0f, (i & 2u) ? 1.0f : -1.0f });
+}
+
+double BenchObjects(std::size_t count, unsigned long long ticks) noexcept
+{
+    std::vector<std::unique_ptr<lepong::Ball>> balls;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto ball = std::make_unique<lepong::Ball>(lepong::Match::skBallRadius);
+
+        GetStartingMotion(i, ball->position, ball->moveDirection);
+        ball->moveSpeed = lepong::Ball::skDefaultMoveSpeed;
+
+        balls.push_back(std::move(ball));
+    }
+
+    return Time([&]
+    {
+        for (unsigned long long t = 0; t < ticks; ++t)
+        {
+            for (auto& ball : balls)
+            {
+                ball->Update(skDelta);
+                ball->CollideWithTerrain(lepong::Match::skArenaSize);
+            }
+        }
+    });
+}
+
+double BenchRegistry(std::size_t count, unsigned long long ticks) noexcept
+{
+    lepong::Ecs::Registry registry;
+    registry.Reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto kEntity = registry.Create();
+
+        lepong::Ecs::Transform transform;
+        lepong::Ecs::Velocity velocity;
+
+        GetStartingMotion(i, transform.position, velocity.direction);
+        velocity.speed = lepong::Ball::skDefaultMoveSpeed;
+
+        registry.transforms.Insert(kEntity, transform);
+        registry.velocities.Insert(kEntity, velocity);
+        registry.colliders.Insert(kEntity, { lepong::Ecs::ColliderShape::Circle, { lepong::Match::skBallRadius, lepong::Match::skBallRadius } });
+        registry.renderBindings.Insert(kEntity, {});
+    }
+
+    return Time([&]
+    {
+        for (unsigned long long t = 0; t < ticks; ++t)
+        {
+            lepong::Ecs::Integrate(registry, skDelta);
+            lepong::Ecs::BounceCirclesOffTerrain(registry, lepong::Match::skArenaSize);
+        }
+    });
+}
+
+void BenchEntities() noexcept
+{
+    std::printf("%10s %16s %16s\n", "entities", "objects ns/upd", "registry ns/upd");
+
+    for (const std::size_t kCount : { 10u, 1'000u, 100'000u })
+    {
+        const auto kTicks = skEntityUpdates / kCount;
+        const auto kUpdates = static_cast<double>(kTicks * kCount);
+
+        const auto kObjects = BenchObjects(kCount, kTicks);
+        const auto kRegistry = BenchRegistry(kCount, kTicks);
+
+        std::printf("%10zu %16.2f %16.2f\n", kCount, kObjects / kUpdates * 1e9, kRegistry / kUpdates * 1e9);
+    }
+}
+
+void BenchBalls(std::size_t count, unsigned threads) noexcept
+{
+    constexpr auto kTicks = 2400;
+
+    lepong::MultiBallSettings settings;
+    settings.gridThreads = threads;
+
+    lepong::MultiBallWorld world(settings);
+    world.Reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        (void)world.Spawn();
+    }
+
+    unsigned long long testedPairs = 0;
+
+    const auto kSeconds = Time([&]
+    {
+        for (auto t = 0; t < kTicks; ++t)
+        {
+            // The paddles sweep up and down every second.
+            const auto kAction = (t / 240) % 2 ? lepong::PaddleAction::Up : lepong::PaddleAction::Down;
+            const lepong::PaddleAction kActions[] = { kAction, kAction };
+
+            world.Step(skDelta, kActions);
+            testedPairs += world.GetTestedPairs();
+        }
+    });
+
+    std::printf("balls:        %zu (%u grid threads)\n", count, threads);
+    std::printf("ticks:        %d\n", kTicks);
+    std::printf("ms/tick:      %.3f\n", kSeconds / kTicks * 1e3);
+    std::printf("ticks/sec:    %.1f (real time needs 240)\n", kTicks / kSeconds);
+    std::printf("pairs/tick:   %.1f\n", static_cast<double>(testedPairs) / kTicks);
+    std::printf("score:        %llu - %llu\n", world.scores[0], world.scores[1]);
+}
+
+void BenchSnapshot() noexcept
+{
+    constexpr auto kTicks = 10'000'000ull;
+    constexpr auto kRollback = 8ull;
+
+    lepong::SnapshotRing ring(64);
+
+    lepong::Match match;
+    match.Launch();
+
+    const auto kSaveSeconds = Time([&]
+    {
+        for (unsigned long long t = 0; t < kTicks; ++t)
+        {
+            // Something changes between saves so that the copies can't be skipped.
+            match.ball.position.x = static_cast<float>(t & 1023u);
+            ring.Save(t, match);
+        }
+    });
+
+    ring.Clear();
+    auto restored = 0ull;
+
+    const auto kRollbackSeconds = Time([&]
+    {
+        for (unsigned long long t = 0; t < kTicks; ++t)
+        {
+            match.ball.position.x = static_cast<float>(t & 1023u);
+            ring.Save(t, match);
+
+            restored += t >= kRollback && ring.Restore(t - kRollback, match) ? 1 : 0;
+        }
+    });
+
+    const auto kRestoreSeconds = kRollbackSeconds - kSaveSeconds;
+
+    std::printf("state size:   %zu bytes\n", sizeof(lepong::GameState));
+    std::printf("save:         %.2f ns\n", kSaveSeconds / kTicks * 1e9);
+    std::printf("restore:      %.2f ns (%llu of %llu found, x %.1f)\n",
+        kRestoreSeconds / kTicks * 1e9, restored, kTicks - kRollback, match.ball.position.x);
+}
+
+void BenchTimeline(unsigned interval) noexcept
+{
+    constexpr auto kTicks = 240ull * 60ull * 60ull;
+    constexpr auto kSeeks = 100'000ull;
+    constexpr auto kPath = "lepong_bench.lptl";
+
+    // The hash of every few states, to check the seeks against.
+    constexpr auto kCheckInterval = 997ull;
+    std::vector<std::uint64_t> hashes;
+
+    lepong::TimelineWriter writer;
+
+    if (!writer.Open(kPath, skDelta, interval))
+    {
+        std::fprintf(stderr, "could not create %s\n", kPath);
+        return;
+    }
+
+    lepong::Match match;
+    match.random = lepong::Random(0);
+
+    const auto kRecordSeconds = Time([&]
+    {
+        for (unsigned long long t = 0; t < kTicks; ++t)
+        {
+            const auto kLaunched = !match.playing;
+
+            if (kLaunched)
+            {
+                match.Launch();
+            }
+
+            const lepong::PaddleAction kActions[] =
+            {
+                lepong::TrackBall(match.paddle1, match.ball),
+                lepong::TrackBall(match.paddle2, match.ball)
+            };
+
+            if (t % kCheckInterval == 0)
+            {
+                hashes.push_back(lepong::HashState(match));
+            }
+
+            writer.Record(match, kLaunched, kActions);
+
+            match.paddle1.ApplyAction(kActions[0]);
+            match.paddle2.ApplyAction(kActions[1]);
+            match.Update(skDelta);
+        }
+    });
+
+    const auto kWritten = writer.Close();
+
+    lepong::TimelineReader reader;
+
+    if (!kWritten || !reader.Open(kPath))
+    {
+        std::fprintf(stderr, "could not write or map %s\n", kPath);
+        std::remove(kPath);
+        return;
+    }
+
+    lepong::Random random(1);
+    std::vector<double> seekTimes(kSeeks);
+
+    for (auto& seekTime : seekTimes)
+    {
+        const auto kTick = random.Next() % kTicks;
+
+        seekTime = Time([&]
+        {
+            reader.Seek(kTick, match);
+        });
+    }
+
+    auto matching = 0ull;
+
+    for (std::size_t i = 0; i < hashes.size(); ++i)
+    {
+        matching += reader.Seek(i * kCheckInterval, match) && lepong::HashState(match) == hashes[i] ? 1 : 0;
+    }
+
+    std::sort(seekTimes.begin(), seekTimes.end());
+
+    auto total = 0.0;
+
+    for (const auto kSeekTime : seekTimes)
+    {
+        total += kSeekTime;
+    }
+
+    long fileSize = 0;
+
+    if (auto* file = std::fopen(kPath, "rb"))
+    {
+        std::fseek(file, 0, SEEK_END);
+        fileSize = std::ftell(file);
+        std::fclose(file);
+    }
+
+    reader.Close();
+    std::remove(kPath);
+
+    std::printf("ticks:        %llu (%.0f minutes), keyframe every %u\n", kTicks, kTicks * skDelta / 60.0, interval);
+    std::printf("file:         %.2f MB, recorded in %.3f s\n", static_cast<double>(fileSize) / 1e6, kRecordSeconds);
+    std::printf("seek:         %.2f us average, %.2f us median, %.2f us p99, %.2f us max\n",
+        total / kSeeks * 1e6, seekTimes[kSeeks / 2] * 1e6, seekTimes[kSeeks * 99 / 100] * 1e6, seekTimes.back() * 1e6);
+    std::printf("checked:      %llu of %zu states match\n", matching, hashes.size());
+}
+
+void BenchRandom() noexcept
+{
+    constexpr auto kCount = 50'000'000ull;
+    constexpr std::size_t kBatch = 4096;
+
+    std::vector<float> values(kBatch);
+    auto sum = 0.0f;
+
+    // Every generator fills the same buffer so that only the generation is timed, not adding the values up.
+    const auto kBench = [&](const char* name, auto fill)
+    {
+        sum = 0.0f;
+
+        const auto kSeconds = Time([&]
+        {
+            for (unsigned long long i = 0; i < kCount; i += kBatch)
+            {
+                fill(values.data());
+                sum += values[i / kBatch & (kBatch - 1)];
+            }
+        });
+
+        std::printf("%-16s %.2f ns per float (sum %.1f)\n", name, kSeconds / static_cast<double>(kCount) * 1e9, sum);
+    };
+
+    kBench("rand", [](float* out)
+    {
+        for (std::size_t j = 0; j < kBatch; ++j)
+        {
+            out[j] = static_cast<float>(std::rand()) * (1.0f / static_cast<float>(RAND_MAX)); // NOLINT: The baseline.
+        }
+    });
+
+    const auto kNextFloats = [](auto generator)
+    {
+        return [generator](float* out) mutable
+        {
+            for (std::size_t j = 0; j < kBatch; ++j)
+            {
+                out[j] = generator.NextFloat();
+            }
+        };
+    };
+
+    kBench("Random", kNextFloats(lepong::Random(1)));
+    kBench("Pcg32", kNextFloats(lepong::Pcg32(1)));
+    kBench("Xoshiro256", kNextFloats(lepong::Xoshiro256(1)));
+
+    lepong::Philox4x32 philox(1);
+
+    kBench("Philox4x32 fill", [&philox](float* out)
+    {
+        philox.FillFloats(out, kBatch);
+    });
+}
+
+///
+/// \return Where the ball crosses the plane, found by stepping a copy of it like a match would.
+///
+float StepToPlane(lepong::Ball ball, float planeX) noexcept
+{
+    constexpr auto kMaxSteps = 100'000;
+
+    const auto kStartSide = ball.position.x < planeX;
+
+    for (auto i = 0; i < kMaxSteps && (ball.position.x < planeX) == kStartSide; ++i)
+    {
+        ball.Update(skDelta);
+        ball.CollideWithTerrain(lepong::Match::skArenaSize);
+    }
+
+    return ball.position.y;
+}
+
+void BenchPredict() noexcept
+{
+    constexpr std::size_t kMatches = 1024;
+    constexpr auto kTicks = 2400u;
+    constexpr auto kQueriesPerPlane = 4u;
+
+    // Only every few queries are stepped, it takes too long otherwise.
+    constexpr auto kSteppedInterval = 61u;
+
+    std::vector<lepong::Match> matches(kMatches);
+
+    for (std::size_t i = 0; i < kMatches; ++i)
+    {
+        matches[i].random = lepong::Random(0, i);
+    }
+
+    lepong::TrajectoryPredictor predictor;
+    predictor.Resize(kMatches);
+
+    const auto kMinY = lepong::Match::skBallRadius;
+    const auto kMaxY = static_cast<float>(lepong::Match::skArenaSize.y) - lepong::Match::skBallRadius;
+
+    auto closedSeconds = 0.0;
+    auto cachedSeconds = 0.0;
+    auto steppedSeconds = 0.0;
+
+    auto queries = 0ull;
+    auto stepped = 0ull;
+    auto checksum = 0.0f;
+    auto error = 0.0;
+    auto maxError = 0.0f;
+
+    for (auto t = 0u; t < kTicks; ++t)
+    {
+        closedSeconds += Time([&]
+        {
+            for (const auto& kMatch : matches)
+            {
+                const auto kVelocity = kMatch.ball.moveDirection * kMatch.ball.moveSpeed;
+
+                for (unsigned p = 0; p < 2; ++p)
+                {
+                    const auto& kPaddle = kMatch.GetPaddle(p);
+                    const auto kPlaneX = kPaddle.position.x + (kPaddle.size.x / 2.0f + kMatch.ball.radius) * kPaddle.forward;
+
+                    for (auto q = 0u; q < kQueriesPerPlane; ++q)
+                    {
+                        lepong::Intercept intercept;
+                        lepong::PredictIntercept(kMatch.ball.position, kVelocity, kPlaneX, kMinY, kMaxY, intercept); checksum += intercept.y;
+                    }
+                }
+            }
+        });
+
+        cachedSeconds += Time([&]
+        {
+            for (std::size_t i = 0; i < kMatches; ++i)
+            {
+                const auto& kMatch = matches[i];
+                const auto kVelocity = kMatch.ball.moveDirection * kMatch.ball.moveSpeed;
+
+                for (unsigned p = 0; p < 2; ++p)
+                {
+                    const auto& kPaddle = kMatch.GetPaddle(p);
+                    const auto kPlaneX = kPaddle.position.x + (kPaddle.size.x / 2.0f + kMatch.ball.radius) * kPaddle.forward;
+
+                    for (auto q = 0u; q < kQueriesPerPlane; ++q)
+                    {
+                        lepong::Intercept intercept;
+                        predictor.Predict(i, kMatch.ball.position, kVelocity, kPlaneX, intercept); checksum += intercept.y;
+                    }
+                }
+            }
+        });
+
+        for (std::size_t i = 0; i < kMatches; ++i)
+        {
+            auto& match = matches[i];
+
+            if ((i + t) % kSteppedInterval == 0)
+            {
+                lepong::Intercept intercept;
+
+                if (match.playing && predictor.PredictPaddle(i, match, 0, intercept))
+                {
+                    const auto kPlaneX = match.paddle1.position.x + (match.paddle1.size.x / 2.0f + match.ball.radius);
+                    float steppedY = 0.0f;
+
+                    steppedSeconds += Time([&]
+                    {
+                        steppedY = StepToPlane(match.ball, kPlaneX);
+                    });
+
+                    const auto kError = std::fabs(steppedY - intercept.y);
+
+                    error += kError;
+                    maxError = std::max(maxError, kError);
+                    ++stepped;
+                }
+            }
+
+            if (!match.playing)
+            {
+                match.Launch();
+            }
+
+            match.paddle1.ApplyAction(lepong::TrackBall(match.paddle1, match.ball));
+            match.paddle2.ApplyAction(lepong::TrackBall(match.paddle2, match.ball));
+            match.Update(skDelta);
+        }
+
+        queries += kMatches * 2 * kQueriesPerPlane;
+    }
+
+    const auto kQueries = static_cast<double>(queries);
+
+    std::printf("queries:      %llu (%zu balls, %zu per tick)\n", queries, kMatches, kMatches * 2 * kQueriesPerPlane);
+    std::printf("stepped:      %.1f ns per query (%llu queries)\n", steppedSeconds / static_cast<double>(stepped) * 1e9, stepped);
+    std::printf("closed form:  %.1f ns per query\n", closedSeconds / kQueries * 1e9);
+    std::printf("cached:       %.1f ns per query (%.1f%% hits)\n", cachedSeconds / kQueries * 1e9,
+        100.0 * static_cast<double>(predictor.GetHits()) / static_cast<double>(predictor.GetHits() + predictor.GetMisses()));
+    std::printf("error:        %.3f average, %.3f max vs stepping (checksum %.1f)\n",
+        error / static_cast<double>(stepped), maxError, checksum);
+}
+
+void BenchVecEnv(std::uint32_t envCount, std::uint32_t frameSkip, std::uint32_t threads) noexcept
+{
+    constexpr auto kSeconds = 2.0;
+
+    std::printf("%10s %14s %16s %12s %8s\n", "obs", "steps/s", "ticks/s", "episodes", "reward");
+
+    for (const auto kObservation : { LEPONG_OBSERVATION_VECTOR, LEPONG_OBSERVATION_PIXELS })
+    {
+        LepongVecEnvSettings settings;
+        lepong_vecenv_default_settings(&settings);
+
+        settings.envCount = envCount;
+        settings.frameSkip = frameSkip;
+        settings.observation = kObservation;
+        settings.threadCount = threads;
+
+        std::unique_ptr<LepongVecEnv, decltype(&lepong_vecenv_destroy)> env(
+            lepong_vecenv_create_with_settings(&settings), &lepong_vecenv_destroy);
+
+        if (!env)
+        {
+            std::fputs("could not create the environments\n", stderr);
+            return;
+        }
+
+        std::vector<std::uint8_t> observations(envCount * lepong_vecenv_get_observation_size(env.get()));
+        std::vector<std::int32_t> actions(envCount);
+        std::vector<float> rewards(envCount);
+        std::vector<std::uint8_t> dones(envCount);
+
+        lepong_vecenv_reset(env.get(), observations.data());
+
+        lepong::Pcg32 random(1);
+        auto steps = 0ull;
+        auto episodes = 0ull;
+        auto reward = 0.0;
+
+        const auto kStart = std::chrono::steady_clock::now();
+        auto seconds = 0.0;
+
+        while (seconds < kSeconds)
+        {
+            // Draw the actions outside of the timed part, only the environments are measured.
+            for (auto& action : actions)
+            {
+                action = static_cast<std::int32_t>(random.Next() % 3u);
+            }
+
+            const auto kStepStart = std::chrono::steady_clock::now();
+            lepong_vecenv_step(env.get(), actions.data(), observations.data(), rewards.data(), dones.data());
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - kStepStart).count();
+
+            for (std::uint32_t i = 0; i < envCount; ++i)
+            {
+                episodes += dones[i];
+                reward += rewards[i];
+            }
+
+            steps += envCount;
+
+            if (std::chrono::duration<double>(std::chrono::steady_clock::now() - kStart).count() > 10.0 * kSeconds)
+            {
+                break;
+            }
+        }
+
+        std::printf("%10s %14.0f %16.0f %12llu %8.0f\n", kObservation == LEPONG_OBSERVATION_PIXELS ? "pixels" : "vector",
+            static_cast<double>(steps) / seconds, static_cast<double>(steps * frameSkip) / seconds,
+            static_cast<unsigned long long>(episodes), reward);
+    }
+}
+
+///
+/// \return The time one step of <i>env</i> takes, in seconds.
+///
+double TimeVecEnvSteps(LepongVecEnv* env) noexcept
+{
+    constexpr auto kSteps = 2000u;
+
+    const auto kCount = lepong_vecenv_get_env_count(env);
+
+    std::vector<std::uint8_t> observations(kCount * lepong_vecenv_get_observation_size(env));
+    std::vector<std::int32_t> actions(kCount, LEPONG_ACTION_STAY);
+    std::vector<float> rewards(kCount);
+    std::vector<std::uint8_t> dones(kCount);
+
+    lepong_vecenv_reset(env, observations.data());
+
+    const auto kSeconds = Time([&]
+    {
+        for (auto step = 0u; step < kSteps; ++step)
+        {
+            lepong_vecenv_step(env, actions.data(), observations.data(), rewards.data(), dones.data());
+        }
+    });
+
+    return kSeconds / kSteps;
+}
+
+void BenchChannel(std::uint32_t envCount) noexcept
+{
+    LepongVecEnvSettings settings;
+    lepong_vecenv_default_settings(&settings);
+    settings.envCount = envCount;
+
+    {
+        std::unique_ptr<LepongVecEnv, decltype(&lepong_vecenv_destroy)> local(
+            lepong_vecenv_create_with_settings(&settings), &lepong_vecenv_destroy);
+
+        if (!local)
+        {
+            std::fputs("could not create the environments\n", stderr);
+            return;
+        }
+
+        std::printf("local:        %.2f us per step\n", TimeVecEnvSteps(local.get()) * 1e6);
+    }
+
+    for (const auto kWait : { LEPONG_WAIT_FUTEX, LEPONG_WAIT_POLL })
+    {
+        const auto kName = "lepong-bench-" + std::to_string(static_cast<int>(kWait));
+        std::thread server([&] { lepong_vecenv_serve(kName.c_str(), &settings, kWait); });
+
+        // The server creates the channel on its own time.
+        std::unique_ptr<LepongVecEnv, decltype(&lepong_vecenv_destroy)> remote(nullptr, &lepong_vecenv_destroy);
+
+        for (auto attempt = 0; attempt < 1000 && !remote; ++attempt)
+        {
+            remote.reset(lepong_vecenv_connect(kName.c_str(), kWait));
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (remote)
+        {
+            std::printf("%-13s %.2f us per step\n", kWait == LEPONG_WAIT_POLL ? "poll:" : "futex:", TimeVecEnvSteps(remote.get()) * 1e6);
+        }
+        else
+        {
+            std::fputs("could not connect to the server\n", stderr);
+        }
+
+        // Stops the server.
+        remote.reset();
+        server.join();
+    }
+}
+
+///
+/// Plays the batch with TrackBall bots for the provided number of ticks.
+///
+void PlayBatch(lepong::MatchBatch& batch, unsigned ticks) noexcept
+{
+    std::vector<lepong::PaddleAction> actions(2 * batch.Size());
+
+    for (auto t = 0u; t < ticks; ++t)
+    {
+        batch.LaunchWaiting();
+
+        lepong::FillTrackBallActions(batch, actions.data());
+        batch.Step(skDelta, actions.data());
+    }
+}
+
+void BenchRules(std::size_t matchCount) noexcept
+{
+    constexpr auto kTicks = 5'000u;
+
+    const auto kLaneTicks = static_cast<double>(kTicks) * static_cast<double>(matchCount);
+
+    for (const auto kKernel : { lepong::BatchKernel::Scalar, lepong::BatchKernel::SSE2, lepong::BatchKernel::AVX2 })
+    {
+        if (!lepong::IsBatchKernelSupported(kKernel))
+        {
+            continue;
+        }
+
+        lepong::MatchBatch batches[] = { lepong::MatchBatch(matchCount), lepong::MatchBatch(matchCount) };
+        double seconds[] = { INFINITY, INFINITY };
+
+        // The best of a few alternated runs, the difference is small next to the noise of a single run.
+        for (auto run = 0; run < 5; ++run)
+        {
+            for (auto i = 0; i < 2; ++i)
+            {
+                batches[i] = lepong::MatchBatch(matchCount);
+                batches[i].SetKernel(kKernel);
+                batches[i].SetSpecialized(i == 0);
+
+                seconds[i] = std::min(seconds[i], Time([&] { PlayBatch(batches[i], kTicks); }));
+            }
+        }
+
+        const auto kSame = [&](const std::vector<float> (&arrays)[2]) noexcept
+        {
+            return !std::memcmp(arrays[0].data(), arrays[1].data(), matchCount * sizeof(float));
+        };
+
+        const std::vector<float> kBallX[] = { batches[0].ballX, batches[1].ballX };
+        const std::vector<float> kBallY[] = { batches[0].ballY, batches[1].ballY };
+        const std::vector<float> kSpeed[] = { batches[0].ballSpeed, batches[1].ballSpeed };
+
+        const auto kIdentical =
+            kSame(kBallX) && kSame(kBallY) && kSame(kSpeed) &&
+            batches[0].scores[0] == batches[1].scores[0] && batches[0].scores[1] == batches[1].scores[1];
+
+        std::printf("%-8s compiled %.3f ns, runtime %.3f ns per match tick (x %.2f), %s\n",
+            lepong::GetBatchKernelName(kKernel),
+            seconds[0] / kLaneTicks * 1e9, seconds[1] / kLaneTicks * 1e9, seconds[1] / seconds[0],
+            kIdentical ? "identical" : "DIFFERENT");
+    }
+}
+
+///
+/// Plays a bot match, launching a new point whenever one ends.
+///
+/// \param counts Where to count the contacts of each type, unused without a buffer.
+///
+lepong::Match PlayContacts(bool continuous, lepong::ContactBuffer* contacts, unsigned long long ticks, unsigned long long (&counts)[3]) noexcept
+{
+    lepong::Match match;
+    match.continuousCollision = continuous;
+    match.contacts = contacts;
+
+    for (unsigned long long t = 0; t < ticks; ++t)
+    {
+        if (!match.playing)
+        {
+            match.Launch();
+        }
+
+        match.paddle1.ApplyAction(lepong::TrackBall(match.paddle1, match.ball));
+        match.paddle2.ApplyAction(lepong::TrackBall(match.paddle2, match.ball));
+
+        if (contacts)
+        {
+            contacts->BeginTick(t);
+        }
+
+        match.Update(skDelta);
+
+        if (contacts)
+        {
+            for (const auto& kContact : *contacts)
+            {
+                ++counts[static_cast<unsigned>(kContact.type)];
+            }
+        }
+    }
+
+    return match;
+}
+
+void BenchContacts() noexcept
+{
+    constexpr auto kTicks = 10'000'000ull;
+
+    for (const auto kContinuous : { false, true })
+    {
+        lepong::ContactBuffer contacts;
+        unsigned long long counts[3] = {};
+
+        lepong::Match matches[2];
+        double seconds[2] = {};
+
+        // Best of 3, the difference is small next to the noise of a single run.
+        for (auto run = 0u; run < 3u; ++run)
+        {
+            for (auto i = 0u; i < 2u; ++i)
+            {
+                unsigned long long runCounts[3] = {};
+                const auto kSeconds = Time([&] { matches[i] = PlayContacts(kContinuous, i ? &contacts : nullptr, kTicks, runCounts); });
+
+                seconds[i] = run ? std::min(seconds[i], kSeconds) : kSeconds;
+
+                if (i)
+                {
+                    std::copy(runCounts, runCounts + 3, counts);
+                }
+            }
+        }
+
+        const auto kIdentical =
+            matches[0].ball.position.x == matches[1].ball.position.x &&
+            matches[0].ball.position.y == matches[1].ball.position.y &&
+            matches[0].scores[0] == matches[1].scores[0] &&
+            matches[0].scores[1] == matches[1].scores[1];
+
+        std::printf("%-11s   %.2f ns/tick without contacts, %.2f with (%+.2f), %s\n", kContinuous ? "continuous" : "discrete",
+            seconds[0] / kTicks * 1e9, seconds[1] / kTicks * 1e9, (seconds[1] - seconds[0]) / kTicks * 1e9,
+            kIdentical ? "identical" : "DIFFERENT");
+        std::printf("              %llu wall, %llu paddle, %llu side contacts\n", counts[0], counts[1], counts[2]);
+    }
+}
+
+///
+/// Plays a bot match and calls <i>hash</i> on it after every tick.
+///
+/// \return The XOR of the hashes so that they can't be skipped.
+///
+template<typename Hash>
+std::uint64_t PlayHashed(bool continuous, unsigned long long ticks, Hash hash) noexcept
+{
+    lepong::Match match;
+    match.continuousCollision = continuous;
+
+    std::uint64_t checksum = 0;
+
+    for (unsigned long long t = 0; t < ticks; ++t)
+    {
+        if (!match.playing)
+        {
+            match.Launch();
+        }
+
+        match.paddle1.ApplyAction(lepong::TrackBall(match.paddle1, match.ball));
+        match.paddle2.ApplyAction(lepong::TrackBall(match.paddle2, match.ball));
+        match.Update(skDelta);
+
+        checksum ^= hash(match);
+    }
+
+    return checksum;
+}
+
+void BenchHash() noexcept
+{
+    constexpr auto kTicks = 10'000'000ull;
+    constexpr auto kCheckedTicks = 1'000'000ull;
+    constexpr auto kCheckedPoints = 10'000u;
+
+    const auto kNone = [](const lepong::Match&) { return std::uint64_t{ 0 }; };
+    const auto kIncremental = [](const lepong::Match& match) { return match.GetStateHash(); };
+    const auto kFull = [](const lepong::Match& match) { return match.ComputeStateHash(); };
+    const auto kBytes = [](const lepong::Match& match) { return lepong::HashState(match); };
+
+    for (const auto kContinuous : { false, true })
+    {
+        double seconds[4] = {};
+        std::uint64_t checksum = 0;
+
+        // Best of 3, the differences are small next to the noise of a single run.
+        for (auto run = 0u; run < 3u; ++run)
+        {
+            double runSeconds[4];
+
+            runSeconds[0] = Time([&] { checksum ^= PlayHashed(kContinuous, kTicks, kNone); });
+            runSeconds[1] = Time([&] { checksum ^= PlayHashed(kContinuous, kTicks, kIncremental); });
+            runSeconds[2] = Time([&] { checksum ^= PlayHashed(kContinuous, kTicks, kFull); });
+            runSeconds[3] = Time([&] { checksum ^= PlayHashed(kContinuous, kTicks, kBytes); });
+
+            for (auto i = 0u; i < 4u; ++i)
+            {
+                seconds[i] = run ? std::min(seconds[i], runSeconds[i]) : runSeconds[i];
+            }
+        }
+
+        const auto kCost = [&](unsigned i) { return (seconds[i] - seconds[0]) / kTicks * 1e9; };
+
+        std::printf("%-11s   %.2f ns/tick without hashing, +%.2f incremental, +%.2f from fields, +%.2f bytes (checksum %016llx)\n",
+            kContinuous ? "continuous" : "discrete", seconds[0] / kTicks * 1e9, kCost(1), kCost(2), kCost(3),
+            static_cast<unsigned long long>(checksum));
+    }
+
+    unsigned long long stale = 0;
+
+    for (const auto kContinuous : { false, true })
+    {
+        static_cast<void>(PlayHashed(kContinuous, kCheckedTicks, [&](const lepong::Match& match)
+        {
+            stale += match.GetStateHash() != match.ComputeStateHash() ? 1u : 0u;
+            return std::uint64_t{ 0 };
+        }));
+    }
+
+    lepong::Match match;
+    lepong::FastForwardSettings settings;
+    lepong::FastForwardStats stats;
+
+    settings.controllers[0].function = lepong::InterceptBall;
+    settings.controllers[1].function = lepong::InterceptBall;
+
+    for (auto i = 0u; i < kCheckedPoints; ++i)
+    {
+        match.Launch();
+        static_cast<void>(lepong::FastForwardPoint(match, settings, stats));
+
+        stale += match.GetStateHash() != match.ComputeStateHash() ? 1u : 0u;
+    }
+
+    std::printf("checked:      %llu ticks and %u fast forwarded points, %llu stale hashes\n", 2 * kCheckedTicks, kCheckedPoints, stale);
+}
+
+// Bricks keep the same size whatever their count, the wall grows instead.
+constexpr lepong::Vector2f skBrickCell = { 24.0f, 12.0f };
+constexpr lepong::Vector2f skBrickHalfSize = { 10.0f, 5.0f };
+
+///
+/// \return A wall of <i>count</i> bricks about as high as it is wide, starting at <i>left</i>, with gaps a ball can't go
+/// through.
+///
+std::vector<lepong::Obstacle> MakeBricks(std::size_t count, float left, lepong::Vector2f& size) noexcept
+{
+    const auto kColumns = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(count) * skBrickCell.y / skBrickCell.x)));
+    const auto kRows = (count + kColumns - 1) / kColumns;
+
+    size = { static_cast<float>(kColumns) * skBrickCell.x, static_cast<float>(kRows) * skBrickCell.y };
+
+    std::vector<lepong::Obstacle> bricks(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto kColumn = static_cast<float>(i % kColumns);
+        const auto kRow = static_cast<float>(i / kColumns);
+
+        bricks[i].center = { left + (kColumn + 0.5f) * skBrickCell.x, (kRow + 0.5f) * skBrickCell.y };
+        bricks[i].halfSize = skBrickHalfSize;
+    }
+
+    return bricks;
+}
+
+///
+/// \return The first brick the circle hits, by testing all of them.
+///
+lepong::ObstacleHit SweepEveryBrick(
+    const std::vector<lepong::Obstacle>& bricks, const lepong::ObstacleTree& tree, const lepong::Vector2f& center, float radius, const lepong::Vector2f& motion) noexcept
+{
+    lepong::ObstacleHit hit;
+
+    for (std::uint32_t i = 0; i < bricks.size(); ++i)
+    {
+        lepong::SweepHit sweep;
+
+        if (tree.IsAlive(i) && lepong::SweepCircleAabb(center, radius, motion, bricks[i].center, bricks[i].halfSize, sweep) &&
+            (hit.obstacle == lepong::ObstacleHit::skNone ? sweep.time <= hit.time : sweep.time < hit.time))
+        {
+            hit.obstacle = i;
+            hit.time = sweep.time;
+            hit.normal = sweep.normal;
+        }
+    }
+
+    return hit;
+}
+
+void BenchBricks(std::size_t ballCount) noexcept
+{
+    constexpr auto kRadius = 4.0f;
+    constexpr auto kSpeed = 600.0f;
+    constexpr auto kBreakoutTicks = 2400;
+
+    std::printf("bricks   depth  build ms  sweep ns  batch ns  every ns  ray ns  removed  remove ns  rebuild us  mismatches\n");
+
+    for (const auto kCount : { 100ul, 1'000ul, 10'000ul, 100'000ul })
+    {
+        // The arena surrounds the wall with room for the paddles.
+        lepong::Vector2f wall;
+        const auto kBricks = MakeBricks(kCount, 200.0f, wall);
+
+        const auto kArenaWidth = wall.x + 400.0f;
+        const auto kArenaHeight = wall.y;
+
+        lepong::ObstacleTree tree;
+
+        const auto kBuildSeconds = Time([&] { tree.Build(kBricks); });
+
+        // Balls all over the arena, ordered by 64 pixel cells like a MultiBallWorld orders them.
+        lepong::Random random(kCount);
+
+        std::vector<lepong::Vector2f> centers(ballCount);
+        std::vector<lepong::Vector2f> motions(ballCount);
+
+        for (std::size_t i = 0; i < ballCount; ++i)
+        {
+            const auto kAngle = random.NextFloat() * 6.2831853f;
+
+            centers[i] = { random.NextFloat() * kArenaWidth, random.NextFloat() * kArenaHeight };
+            motions[i] = lepong::Vector2f{ std::cos(kAngle), std::sin(kAngle) } * (kSpeed * skDelta);
+        }
+
+        std::vector<std::size_t> order(ballCount);
+        std::iota(order.begin(), order.end(), std::size_t{ 0 });
+
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+        {
+            const auto kCell = [&](std::size_t i) { return static_cast<int>(centers[i].y / 64.0f) * 64 + static_cast<int>(centers[i].x / 64.0f); };
+            return kCell(a) < kCell(b);
+        });
+
+        {
+            auto sortedCenters = centers;
+            auto sortedMotions = motions;
+
+            for (std::size_t i = 0; i < ballCount; ++i)
+            {
+                sortedCenters[i] = centers[order[i]];
+                sortedMotions[i] = motions[order[i]];
+            }
+
+            centers.swap(sortedCenters);
+            motions.swap(sortedMotions);
+        }
+
+        // Enough repetitions for every size to take a similar time.
+        const auto kRepeats = std::max(1ul, 2'000'000ul / ballCount / (kCount >= 10'000ul ? 4ul : 1ul));
+        const auto kQueries = static_cast<double>(kRepeats * ballCount);
+
+        std::vector<lepong::ObstacleHit> hits(ballCount);
+        std::vector<lepong::ObstacleHit> batchHits(ballCount);
+        std::uint64_t checksum = 0;
+
+        const auto kSweepSeconds = Time([&]
+        {
+            for (unsigned long r = 0; r < kRepeats; ++r)
+            {
+                for (std::size_t i = 0; i < ballCount; ++i)
+                {
+                    checksum += tree.SweepCircle(centers[i], kRadius, motions[i], hits[i]) ? 1u : 0u;
+                }
+            }
+        });
+
+        const auto kBatchSeconds = Time([&]
+        {
+            for (unsigned long r = 0; r < kRepeats; ++r)
+            {
+                checksum += tree.SweepCircles(centers.data(), motions.data(), ballCount, kRadius, batchHits.data());
+            }
+        });
+
+        // Testing every brick is slow with many bricks, a few rounds are enough.
+        const auto kEveryRepeats = std::max(1ul, 20'000'000ul / ballCount / kCount);
+        unsigned long long mismatches = 0;
+
+        const auto kEverySeconds = Time([&]
+        {
+            for (unsigned long r = 0; r < kEveryRepeats; ++r)
+            {
+                for (std::size_t i = 0; i < ballCount; ++i)
+                {
+                    const auto kHit = SweepEveryBrick(kBricks, tree, centers[i], kRadius, motions[i]);
+
+                    // Bricks touched at the same time can be found in another order, only the time must match.
+                    mismatches += kHit.time != hits[i].time || kHit.time != batchHits[i].time ||
+                        (kHit.obstacle == lepong::ObstacleHit::skNone) != (hits[i].obstacle == lepong::ObstacleHit::skNone) ||
+                        (kHit.obstacle == lepong::ObstacleHit::skNone) != (batchHits[i].obstacle == lepong::ObstacleHit::skNone) ? 1u : 0u;
+                }
+            }
+        });
+
+        // Rays from the left paddle to random points of the wall. Rays almost parallel to the rows would go along the
+        // gaps and pass every brick of a row.
+        std::vector<lepong::Vector2f> rayOrigins(ballCount);
+        std::vector<lepong::Vector2f> rays(ballCount);
+
+        for (std::size_t i = 0; i < ballCount; ++i)
+        {
+            rayOrigins[i] = { 50.0f, random.NextFloat() * kArenaHeight };
+            rays[i] = lepong::Vector2f{ 200.0f + random.NextFloat() * wall.x, random.NextFloat() * kArenaHeight } - rayOrigins[i];
+        }
+
+        const auto kRaySeconds = Time([&]
+        {
+            for (unsigned long r = 0; r < kRepeats; ++r)
+            {
+                for (std::size_t i = 0; i < ballCount; ++i)
+                {
+                    lepong::ObstacleHit hit;
+                    checksum += tree.Raycast(rayOrigins[i], rays[i], hit) ? hit.obstacle : 0u;
+                }
+            }
+        });
+
+        // Breakout: the balls bounce off the walls and the bricks, which break.
+        std::size_t removed = 0;
+
+        const auto kBreakoutSeconds = Time([&]
+        {
+            for (auto t = 0; t < kBreakoutTicks; ++t)
+            {
+                static_cast<void>(tree.SweepCircles(centers.data(), motions.data(), ballCount, kRadius, batchHits.data()));
+
+                for (std::size_t i = 0; i < ballCount; ++i)
+                {
+                    auto& center = centers[i];
+                    auto& motion = motions[i];
+                    const auto& kHit = batchHits[i];
+
+                    if (kHit.obstacle != lepong::ObstacleHit::skNone)
+                    {
+                        center += motion * kHit.time;
+
+                        // Reflects the motion off the brick.
+                        const auto kDot = motion.x * kHit.normal.x + motion.y * kHit.normal.y;
+                        motion = motion - kHit.normal * (2.0f * kDot);
+
+                        removed += tree.IsAlive(kHit.obstacle) ? 1u : 0u;
+                        tree.Remove(kHit.obstacle);
+                    }
+                    else
+                    {
+                        center += motion;
+                    }
+
+                    motion.x = (center.x < kRadius && motion.x < 0.0f) || (center.x > kArenaWidth - kRadius && motion.x > 0.0f) ? -motion.x : motion.x;
+                    motion.y = (center.y < kRadius && motion.y < 0.0f) || (center.y > kArenaHeight - kRadius && motion.y > 0.0f) ? -motion.y : motion.y;
+                }
+            }
+        });
+
+        // The time spent in removals alone.
+        tree.RestoreAll();
+
+        std::vector<std::uint32_t> removals(kCount);
+        std::iota(removals.begin(), removals.end(), 0u);
+
+        for (std::size_t i = kCount; i > 1; --i)
+        {
+            std::swap(removals[i - 1], removals[random.Next() % i]);
+        }
+
+        const auto kRemoveSeconds = Time([&]
+        {
+            for (const auto kBrick : removals)
+            {
+                tree.Remove(kBrick);
+            }
+        });
+
+        std::printf("%-7lu  %5u  %8.3f  %8.1f  %8.1f  %8.1f  %6.1f  %7zu  %9.1f  %10.1f  %llu (checksum %llu, %.0f ms of breakout)\n",
+            kCount, tree.GetDepth(), kBuildSeconds * 1e3, kSweepSeconds / kQueries * 1e9, kBatchSeconds / kQueries * 1e9,
+            kEverySeconds / static_cast<double>(kEveryRepeats * ballCount) * 1e9, kRaySeconds / kQueries * 1e9,
+            removed, kRemoveSeconds / static_cast<double>(kCount) * 1e9, kBuildSeconds * 1e6, mismatches,
+            static_cast<unsigned long long>(checksum), kBreakoutSeconds * 1e3);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc == 2 && !std::strcmp(argv[1], "entities"))
+    {
+        BenchEntities();
+        return 0;
+    }
+
+    if (argc >= 2 && argc <= 4 && !std::strcmp(argv[1], "balls"))
+    {
+        const auto kCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 100'000ul;
+        const auto kThreads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1ul;
+
+        BenchBalls(kCount, static_cast<unsigned>(kThreads));
+        return 0;
+    }
+
+    if (argc == 2 && !std::strcmp(argv[1], "snapshot"))
+    {
+        BenchSnapshot();
+        return 0;
+    }
+
+    if (argc >= 2 && argc <= 3 && !std::strcmp(argv[1], "timeline"))
+    {
+        const auto kInterval = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 240ul;
+
+        BenchTimeline(static_cast<unsigned>(kInterval));
+        return 0;
+    }
+
+    if (argc == 2 && !std::strcmp(argv[1], "predict"))
+    {
+        BenchPredict();
+        return 0;
+    }
+
+    if (argc == 2 && !std::strcmp(argv[1], "random"))
+    {
+        BenchRandom();
+        return 0;
+    }
+
+    if (argc >= 2 && argc <= 5 && !std::strcmp(argv[1], "vecenv"))
+    {
+        const auto kEnvs = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4096ul;
+        const auto kFrameSkip = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 4ul;
+        const auto kThreads = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 1ul;
+
+        BenchVecEnv(static_cast<std::uint32_t>(kEnvs), static_cast<std::uint32_t>(kFrameSkip), static_cast<std::uint32_t>(kThreads));
+        return 0;
+    }
+
+    if (argc >= 2 && argc <= 3 && !std::strcmp(argv[1], "channel"))
+    {
+        const auto kEnvs = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1024ul;
+
+        BenchChannel(static_cast<std::uint32_t>(kEnvs));
+        return 0;
+    }
+
+    if (argc >= 2 && argc <= 3 && !std::strcmp(argv[1], "rules"))
+    {
+        const auto kMatches = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1024ul;
+
+        BenchRules(kMatches);
+        return 0;
+    }
+
+    if (argc == 2 && !std::strcmp(argv[1], "contacts"))
+    {
+        BenchContacts();
+        return 0;
+    }
+
+    if (argc == 2 && !std::strcmp(argv[1], "hash"))
+    {
+        BenchHash();
+        return 0;
+    }
+
+    if (argc >= 2 && argc <= 3 && !std::strcmp(argv[1], "bricks"))
+    {
+        const auto kBalls = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1024ul;
+
+        BenchBricks(kBalls);
+        return 0;
+    }
+
+    std::fputs("usage: lepong_bench entities\n       lepong_bench balls [COUNT] [THREADS]\n       lepong_bench snapshot\n       lepong_bench timeline [INTERVAL]\n       lepong_bench random\n       lepong_bench predict\n       lepong_bench vecenv [ENVS] [FRAMESKIP] [THREADS]\n       lepong_bench channel [ENVS]\n       lepong_bench rules [MATCHES]\n       lepong_bench contacts\n       lepong_bench hash\n       lepong_bench bricks [BALLS]\n", stderr);
+    return -1;
+}
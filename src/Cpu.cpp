@@ -0,0 +1,68 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#if defined(LEPONG_X86_KERNELS) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "lepong/Check.h"
+#include "lepong/Cpu.h"
+
+namespace lepong::Cpu
+{
+
+#if defined(LEPONG_X86_KERNELS)
+
+///
+/// Does the actual checking, the result is cached by <i>HasAVX2</i>.
+///
+LEPONG_NODISCARD static bool DetectAVX2() noexcept
+{
+#if defined(_MSC_VER)
+    int info[4];
+
+    __cpuid(info, 1);
+    const auto kOSXSave = (info[2] & (1 << 27)) != 0;
+    const auto kAVX = (info[2] & (1 << 28)) != 0;
+
+    LEPONG_CHECK_OR_RETURN_VAL(kOSXSave && kAVX, false);
+
+    // The OS must save the upper halves of the registers.
+    const auto kXCR0 = _xgetbv(0);
+    LEPONG_CHECK_OR_RETURN_VAL((kXCR0 & 0x6) == 0x6, false);
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+bool HasSSE2() noexcept
+{
+    // Every CPU we build the x86 kernels for has SSE2.
+    return true;
+}
+
+bool HasAVX2() noexcept
+{
+    static const auto skHasAVX2 = DetectAVX2();
+    return skHasAVX2;
+}
+
+#else
+
+bool HasSSE2() noexcept
+{
+    return false;
+}
+
+bool HasAVX2() noexcept
+{
+    return false;
+}
+
+#endif
+
+} // namespace lepong::Cpu
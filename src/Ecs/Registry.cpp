@@ -0,0 +1,49 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Check.h"
+#include "lepong/Ecs/Registry.h"
+
+namespace lepong::Ecs
+{
+
+Entity Registry::Create() noexcept
+{
+    if (mFreeEntities.empty())
+    {
+        mAlive.push_back(1u);
+        return mNextEntity++;
+    }
+
+    const auto kEntity = mFreeEntities.back();
+    mFreeEntities.pop_back();
+
+    mAlive[kEntity] = 1u;
+    return kEntity;
+}
+
+void Registry::Destroy(Entity entity) noexcept
+{
+    // Freeing an entity twice would hand it out twice.
+    LEPONG_CHECK_OR_RETURN(IsAlive(entity));
+
+    mAlive[entity] = 0u;
+
+    transforms.Remove(entity);
+    velocities.Remove(entity);
+    colliders.Remove(entity);
+    renderBindings.Remove(entity);
+
+    mFreeEntities.push_back(entity);
+}
+
+void Registry::Reserve(std::size_t count) noexcept
+{
+    transforms.Reserve(count);
+    velocities.Reserve(count);
+    colliders.Reserve(count);
+    renderBindings.Reserve(count);
+}
+
+} // namespace lepong::Ecs
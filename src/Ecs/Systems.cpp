@@ -0,0 +1,120 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+
+#include "lepong/Ecs/Systems.h"
+
+namespace lepong::Ecs
+{
+
+///
+/// \return Whether the first <i>count</i> components of <i>pool</i> belong to <i>entities</i>, in the same order.
+/// Checking once is much cheaper than a lookup per component.
+///
+template<typename Component>
+LEPONG_NODISCARD static bool IsAligned(const ComponentPool<Component>& pool, const Entity* entities, std::size_t count) noexcept
+{
+    return pool.Size() >= count && std::equal(entities, entities + count, pool.Entities());
+}
+
+///
+/// \return The index of the entity's component in <i>pool</i>, or <i>skNullEntity</i> if it has none. Checks
+/// <i>hint</i> first, the index the component has when the pools are in the same order.
+///
+template<typename Component>
+LEPONG_NODISCARD static std::uint32_t FindIndex(const ComponentPool<Component>& pool, Entity entity, std::size_t hint) noexcept
+{
+    if (hint < pool.Size() && pool.Entities()[hint] == entity)
+    {
+        return static_cast<std::uint32_t>(hint);
+    }
+
+    return pool.Has(entity) ? pool.GetIndex(entity) : skNullEntity;
+}
+
+void Integrate(Registry& registry, float delta) noexcept
+{
+    const auto kCount = registry.velocities.Size();
+
+    const auto* velocities = registry.velocities.Data();
+    const auto* entities = registry.velocities.Entities();
+
+    auto* transforms = registry.transforms.Data();
+
+    if (IsAligned(registry.transforms, entities, kCount))
+    {
+        for (std::size_t i = 0; i < kCount; ++i)
+        {
+            transforms[i].position += velocities[i].direction * velocities[i].speed * delta;
+        }
+
+        return;
+    }
+
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        const auto kTransform = FindIndex(registry.transforms, entities[i], i);
+
+        if (kTransform != skNullEntity)
+        {
+            transforms[kTransform].position += velocities[i].direction * velocities[i].speed * delta;
+        }
+    }
+}
+
+void BounceCirclesOffTerrain(Registry& registry, const Vector2i& arenaSize) noexcept
+{
+    const auto kCount = registry.colliders.Size();
+    const auto kArenaHeight = static_cast<float>(arenaSize.y);
+
+    const auto* colliders = registry.colliders.Data();
+    const auto* entities = registry.colliders.Entities();
+
+    const auto* transforms = registry.transforms.Data();
+    auto* velocities = registry.velocities.Data();
+
+    if (IsAligned(registry.transforms, entities, kCount) && IsAligned(registry.velocities, entities, kCount))
+    {
+        for (std::size_t i = 0; i < kCount; ++i)
+        {
+            const auto kRadius = colliders[i].halfSize.x;
+            const auto kY = transforms[i].position.y;
+            auto& direction = velocities[i].direction;
+
+            const auto kCollidesTop = (kY > kArenaHeight - kRadius) && (direction.y > 0);
+            const auto kCollidesBottom = (kY < kRadius) && (direction.y < 0);
+            const auto kBounces = colliders[i].shape == ColliderShape::Circle && (kCollidesTop || kCollidesBottom);
+
+            direction.y = kBounces ? -direction.y : direction.y;
+        }
+
+        return;
+    }
+
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        const auto kVelocity = FindIndex(registry.velocities, entities[i], i);
+        const auto kTransform = FindIndex(registry.transforms, entities[i], i);
+
+        if (colliders[i].shape != ColliderShape::Circle || kVelocity == skNullEntity || kTransform == skNullEntity)
+        {
+            continue;
+        }
+
+        const auto kRadius = colliders[i].halfSize.x;
+        const auto& kPosition = transforms[kTransform].position;
+        auto& direction = velocities[kVelocity].direction;
+
+        const auto kCollidesTop = (kPosition.y > kArenaHeight - kRadius) && (direction.y > 0);
+        const auto kCollidesBottom = (kPosition.y < kRadius) && (direction.y < 0);
+
+        if (kCollidesTop || kCollidesBottom)
+        {
+            direction.y = -direction.y;
+        }
+    }
+}
+
+} // namespace lepong::Ecs
@@ -2,24 +2,19 @@
 // Created by lepouki on 11/2/2020.
 //
 
-#include "lepong/Graphics/Quad.h"
+#include <limits>
+
+#include "lepong/Check.h"
+#include "lepong/Math/Collision.h"
 
 #include "lepong/Game/Ball.h"
 
 namespace lepong
 {
 
-Ball::Ball(float radius, Graphics::Mesh& mesh, GLuint& program) noexcept
-    : mMesh(mesh)
-    , mProgram(program)
-    , radius(radius)
-{
-}
-
-void Ball::Render() const noexcept
+Ball::Ball(float radius) noexcept
+    : radius(radius)
 {
-    const auto kDiameter = radius * 2.0f;
-    Graphics::DrawQuad(mMesh, Vector2f{ kDiameter, kDiameter }, position, mProgram);
 }
 
 void Ball::CollideWithTerrain(const Vector2i& winSize) noexcept
@@ -29,7 +24,7 @@ void Ball::CollideWithTerrain(const Vector2i& winSize) noexcept
 
     if (kCollidesTop || kCollidesBottom)
     {
-        moveDirection.y = -moveDirection.y;
+        SetMoveDirection({ moveDirection.x, -moveDirection.y });
     }
 }
 
@@ -77,10 +72,10 @@ Side Ball::GetTouchingSide(const Vector2i& winSize) const noexcept
 
 void Ball::Reset(const Vector2i& winSize) noexcept
 {
-    position = { winSize.x / 2.0f, winSize.y / 2.0f };
+    SetPosition({ winSize.x / 2.0f, winSize.y / 2.0f });
 
-    moveSpeed = 0.0f;
-    moveDirection = { 0.0f, 0.0f };
+    SetMoveSpeed(0.0f);
+    SetMoveDirection({ 0.0f, 0.0f });
 }
 
 bool Ball::IsBehind(const Paddle& paddle) const noexcept
@@ -131,35 +126,44 @@ bool Ball::DoCollideWith(const Paddle& paddle) noexcept
 
 void Ball::OnPaddleCollision(const Paddle& paddle) noexcept
 {
-    moveSpeed += 50.0f;
-    moveDirection = Normalize(position - paddle.position);
+    SetMoveSpeed(moveSpeed + 50.0f);
+    SetMoveDirection(Normalize(position - paddle.position));
 }
 
-GLuint MakeBallFragmentShader() noexcept
+float Ball::GetTerrainImpactTime(const Vector2f& motion, const Vector2i& winSize) const noexcept
 {
-    constexpr auto kSource =
-    R"(
+    auto time = std::numeric_limits<float>::infinity();
 
-    #version 330 core
-
-    in vec2 vTextureCoords;
+    // Same conditions as CollideWithTerrain, a ball already past the limit bounces right away.
+    if (motion.y > 0.0f && moveDirection.y > 0)
+    {
+        time = (static_cast<float>(winSize.y) - radius - position.y) / motion.y;
+    }
+    else if (motion.y < 0.0f && moveDirection.y < 0)
+    {
+        time = (radius - position.y) / motion.y;
+    }
 
-    out vec4 FragColor;
+    return time < 0.0f ? 0.0f : time;
+}
 
-    void main()
-    {
-        vec2 textureCoordsCentered = vTextureCoords * 2.0 - vec2(1.0);
-        float squareDistanceToCenter = dot(textureCoordsCentered, textureCoordsCentered);
+bool Ball::SweepAgainst(const Paddle& paddle, const Vector2f& motion, const Vector2f& paddleMotion, float& time) const noexcept
+{
+    const auto kMovingToward = (moveDirection.x * paddle.forward) < 0.0f;
+    LEPONG_CHECK_OR_RETURN_VAL(kMovingToward, false);
 
-        // Simple glow.
-        float intensity = 1.0 - pow(squareDistanceToCenter, 3.0);
+    // Same grace zone as DoCollideWith.
+    const auto kPaddleGraceZone = paddle.size.y * 0.1f;
+    const Vector2f kHalfSize = { paddle.size.x / 2.0f, paddle.size.y / 2.0f + kPaddleGraceZone };
 
-        FragColor = vec4(intensity);
-    }
+    SweepHit hit;
+    const auto kHits = SweepCircleAabb(position, radius, motion - paddleMotion, paddle.position, kHalfSize, hit);
 
-    )";
+    // The sides and the back of the paddle don't count, the ball goes past the paddle in those cases.
+    LEPONG_CHECK_OR_RETURN_VAL(kHits && (hit.normal.x * paddle.forward) > 0.0f, false);
 
-    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+    time = hit.time;
+    return true;
 }
 
 } // namespace lepong
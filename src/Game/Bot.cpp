@@ -0,0 +1,26 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Game/Bot.h"
+
+namespace lepong
+{
+
+PaddleAction TrackBall(const Paddle& paddle, const Ball& ball, float deadZone) noexcept
+{
+    const auto kOffset = ball.position.y - paddle.position.y;
+
+    if (kOffset > deadZone)
+    {
+        return PaddleAction::Up;
+    }
+    else if (kOffset < -deadZone)
+    {
+        return PaddleAction::Down;
+    }
+
+    return PaddleAction::Stay;
+}
+
+} // namespace lepong
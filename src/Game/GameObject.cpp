@@ -9,7 +9,7 @@ namespace lepong
 
 void GameObject::Update(float delta) noexcept
 {
-    position += moveDirection * moveSpeed * delta;
+    SetPosition(position + moveDirection * moveSpeed * delta);
 }
 
 } // namespace lepong
@@ -0,0 +1,295 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cmath>
+
+#include "lepong/Check.h"
+
+#include "lepong/Game/Match.h"
+
+namespace lepong
+{
+
+Match::Match() noexcept
+{
+    Reset();
+    PositionPaddlesOnTerrain();
+}
+
+void Match::Reset() noexcept
+{
+    ball.Reset(skArenaSize);
+
+    paddle1.Reset(skArenaSize);
+    paddle2.Reset(skArenaSize);
+
+    playing = false;
+}
+
+void Match::Launch() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(!playing);
+
+    playing = true;
+
+    ball.SetMoveSpeed(Ball::skDefaultMoveSpeed);
+
+    const Vector2f kDirection = { random.NextSignFloat(), random.NextSignFloat() };
+    ball.SetMoveDirection(Normalize(kDirection));
+}
+
+Side Match::Update(float delta) noexcept
+{
+    mSubstepBegin = 0.0f;
+    mSubstepLength = 1.0f;
+
+    return continuousCollision ? UpdateContinuous(delta) : UpdateDiscrete(delta);
+}
+
+Side Match::UpdateDiscrete(float delta) noexcept
+{
+    auto lostSide = Side::None;
+
+    const auto kMotion = ball.moveDirection * ball.moveSpeed * delta;
+    ball.Update(delta);
+
+    paddle1.Update(delta, skArenaSize);
+    paddle2.Update(delta, skArenaSize);
+
+    if (!CollideBall(kMotion, 1.0f))
+    {
+        CheckBallSideCollision(lostSide, kMotion, 1.0f);
+    }
+
+    return lostSide;
+}
+
+bool Match::CollideBall(const Vector2f& motion, float fraction) noexcept
+{
+    const auto kDirectionY = ball.moveDirection.y;
+    const auto kSpeed = ball.moveSpeed;
+
+    ball.CollideWithTerrain(skArenaSize);
+
+    if (contacts && ball.moveDirection.y != kDirectionY)
+    {
+        const auto kTop = kDirectionY > 0.0f;
+        const auto kPenetration = kTop ? ball.position.y - (static_cast<float>(skArenaSize.y) - ball.radius) : ball.radius - ball.position.y;
+
+        PushOverlapContact(ContactType::Wall, 0, { 0.0f, kTop ? -1.0f : 1.0f }, kPenetration, motion, fraction, kSpeed);
+    }
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        const auto& kPaddle = GetPaddle(p);
+
+        if (ball.CollideWith(kPaddle))
+        {
+            if (contacts)
+            {
+                const auto kFront = kPaddle.position.x + (kPaddle.size.x / 2.0f) * kPaddle.forward;
+                const auto kPenetration = ball.radius - (ball.position.x - kFront) * kPaddle.forward;
+
+                PushOverlapContact(ContactType::Paddle, p, { kPaddle.forward, 0.0f }, kPenetration, motion, fraction, kSpeed);
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Side Match::UpdateContinuous(float delta) noexcept
+{
+    // Fast balls get more substeps so that the paddles, which move during a substep too, stay accurate.
+    const auto kDistance = ball.moveSpeed * delta;
+    auto substeps = static_cast<unsigned>(std::ceil(kDistance / skMaxSubstepDistance));
+
+    substeps = substeps < 1u ? 1u : (substeps > skMaxSubsteps ? skMaxSubsteps : substeps);
+
+    const auto kSubstepDelta = delta / static_cast<float>(substeps);
+    auto lostSide = Side::None;
+
+    mSubstepLength = 1.0f / static_cast<float>(substeps);
+
+    for (unsigned i = 0; i < substeps && lostSide == Side::None; ++i)
+    {
+        mSubstepBegin = static_cast<float>(i) * mSubstepLength;
+        lostSide = UpdateContinuousSubstep(kSubstepDelta);
+    }
+
+    return lostSide;
+}
+
+Side Match::UpdateContinuousSubstep(float delta) noexcept
+{
+    const Vector2f kPaddleStarts[] = { paddle1.position, paddle2.position };
+
+    paddle1.Update(delta, skArenaSize);
+    paddle2.Update(delta, skArenaSize);
+
+    // The fraction of the substep the ball still has to move.
+    auto remaining = 1.0f;
+    auto collides = false;
+
+    for (unsigned i = 0; i < skMaxContactsPerSubstep && remaining > 0.0f; ++i)
+    {
+        if (!SweepBall(delta, kPaddleStarts, remaining, collides))
+        {
+            break;
+        }
+    }
+
+    const auto kMotion = ball.moveDirection * ball.moveSpeed * (delta * remaining);
+
+    if (remaining > 0.0f)
+    {
+        ball.Update(delta * remaining);
+    }
+
+    // Catches balls the paddles moved onto, sweeps ignore those.
+    collides = CollideBall(kMotion, remaining) || collides;
+
+    auto lostSide = Side::None;
+
+    if (!collides)
+    {
+        CheckBallSideCollision(lostSide, kMotion, remaining);
+    }
+
+    return lostSide;
+}
+
+bool Match::SweepBall(float delta, const Vector2f (&paddleStarts)[2], float& remaining, bool& hitPaddle) noexcept
+{
+    const auto kMotion = ball.moveDirection * ball.moveSpeed * (delta * remaining);
+
+    // The paddles move linearly from their start to their current position during the substep.
+    const auto kElapsed = 1.0f - remaining;
+
+    auto earliest = ball.GetTerrainImpactTime(kMotion, skArenaSize);
+    const Paddle* hitTarget = nullptr;
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        auto paddle = GetPaddle(p);
+        const auto kPaddleMotion = paddle.position - paddleStarts[p];
+
+        paddle.position = paddleStarts[p] + kPaddleMotion * kElapsed;
+
+        auto time = 0.0f;
+        const auto kHits = ball.SweepAgainst(paddle, kMotion, kPaddleMotion * remaining, time);
+
+        if (kHits && time <= earliest)
+        {
+            earliest = time;
+            hitTarget = &GetPaddle(p);
+        }
+    }
+
+    LEPONG_CHECK_OR_RETURN_VAL(earliest <= 1.0f, false);
+
+    ball.SetPosition(ball.position + kMotion * earliest);
+    remaining -= remaining * earliest;
+
+    const auto kSpeed = ball.moveSpeed;
+
+    if (hitTarget)
+    {
+        const auto kPlayer = hitTarget == &paddle2 ? 1u : 0u;
+
+        // Bounce off the paddle where it is at the time of the contact.
+        auto paddle = *hitTarget;
+        paddle.position = Lerp(paddleStarts[kPlayer], hitTarget->position, 1.0f - remaining);
+
+        ball.OnPaddleCollision(paddle);
+        hitPaddle = true;
+
+        if (contacts)
+        {
+            PushContact(ContactType::Paddle, kPlayer, { paddle.forward, 0.0f }, 1.0f - remaining, kSpeed);
+        }
+    }
+    else
+    {
+        const auto kTop = ball.moveDirection.y > 0.0f;
+        ball.SetMoveDirection({ ball.moveDirection.x, -ball.moveDirection.y });
+
+        if (contacts)
+        {
+            PushContact(ContactType::Wall, 0, { 0.0f, kTop ? -1.0f : 1.0f }, 1.0f - remaining, kSpeed);
+        }
+    }
+
+    return true;
+}
+
+void Match::PositionPaddlesOnTerrain() noexcept
+{
+    paddle1.SetPosition({ skPaddleBorderOffset, paddle1.position.y });
+    paddle2.SetPosition({ skArenaSize.x - skPaddleBorderOffset, paddle2.position.y });
+}
+
+void Match::CheckBallSideCollision(Side& lostSide, const Vector2f& motion, float fraction) noexcept
+{
+    lostSide = ball.GetTouchingSide(skArenaSize);
+
+    if (lostSide != Side::None)
+    {
+        if (contacts)
+        {
+            const auto kLeft = lostSide == Side::Player1;
+            const auto kPenetration = kLeft ? ball.radius - ball.position.x : ball.position.x - (static_cast<float>(skArenaSize.x) - ball.radius);
+
+            PushOverlapContact(ContactType::Side, kLeft ? 0u : 1u, { kLeft ? 1.0f : -1.0f, 0.0f }, kPenetration, motion, fraction, ball.moveSpeed);
+        }
+
+        // The player who won the point is the player opposite to the side.
+        const auto kScoreIndex = 1u - static_cast<unsigned>(lostSide);
+        ++scores[kScoreIndex];
+
+        Reset();
+    }
+}
+
+void Match::PushOverlapContact(
+    ContactType type, unsigned player, const Vector2f& normal, float penetration, const Vector2f& motion, float fraction,
+    float speedBefore) noexcept
+{
+    // How far the ball moved toward what it touched.
+    const auto kApproach = -(motion.x * normal.x + motion.y * normal.y);
+
+    auto back = kApproach > 0.0f ? penetration / kApproach : 0.0f;
+    back = back < 0.0f ? 0.0f : (back > 1.0f ? 1.0f : back);
+
+    const auto kCenter = ball.position - motion * back;
+
+    Contact contact;
+    contact.time = mSubstepBegin + mSubstepLength * (1.0f - fraction * back);
+    contact.type = type;
+    contact.player = static_cast<std::uint8_t>(player);
+    contact.point = kCenter - normal * ball.radius;
+    contact.normal = normal;
+    contact.speedBefore = speedBefore;
+    contact.speedAfter = type == ContactType::Side ? 0.0f : ball.moveSpeed;
+
+    contacts->Push(contact);
+}
+
+void Match::PushContact(ContactType type, unsigned player, const Vector2f& normal, float time, float speedBefore) noexcept
+{
+    Contact contact;
+    contact.time = mSubstepBegin + mSubstepLength * time;
+    contact.type = type;
+    contact.player = static_cast<std::uint8_t>(player);
+    contact.point = ball.position - normal * ball.radius;
+    contact.normal = normal;
+    contact.speedBefore = speedBefore;
+    contact.speedAfter = type == ContactType::Side ? 0.0f : ball.moveSpeed;
+
+    contacts->Push(contact);
+}
+
+} // namespace lepong
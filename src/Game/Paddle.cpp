@@ -2,26 +2,17 @@
 // Created by lepouki on 11/2/2020.
 //
 
-#include "lepong/Graphics/Quad.h"
-
 #include "lepong/Game/Paddle.h"
 
 namespace lepong
 {
 
-Paddle::Paddle(const Vector2f& size, float forward, Graphics::Mesh& mesh, GLuint& program) noexcept
-    : mMesh(mesh)
-    , mProgram(program)
-    , size(size)
+Paddle::Paddle(const Vector2f& size, float forward) noexcept
+    : size(size)
     , forward(forward)
 {
 }
 
-void Paddle::Render() const noexcept
-{
-    Graphics::DrawQuad(mMesh, size, position, mProgram);
-}
-
 void Paddle::Update(float delta, const Vector2i& winSize) noexcept
 {
     const auto kPreUpdatePosition = position;
@@ -39,36 +30,36 @@ void Paddle::CollideWithTerrain(const Vector2i& winSize, const Vector2f& preUpda
 
     if (kCollidesTop || kCollidesBottom)
     {
-        position = preUpdatePosition;
+        SetPosition(preUpdatePosition);
     }
 }
 
 void Paddle::Reset(const Vector2i& winSize) noexcept
 {
-    position.y = winSize.y / 2.0f;
+    SetPosition({ position.x, winSize.y / 2.0f });
 
-    moveSpeed = 0.0f;
-    moveDirection = { 0.0f, 0.0f };
+    SetMoveSpeed(0.0f);
+    SetMoveDirection({ 0.0f, 0.0f });
 }
 
 void Paddle::OnMoveUpPressed() noexcept
 {
-    moveSpeed = skDefaultMoveSpeed;
-    moveDirection.y = 1.0f;
+    SetMoveSpeed(skDefaultMoveSpeed);
+    SetMoveDirection({ moveDirection.x, 1.0f });
 }
 
 void Paddle::OnMoveDownPressed() noexcept
 {
-    moveSpeed = skDefaultMoveSpeed;
-    moveDirection.y = -1.0f;
+    SetMoveSpeed(skDefaultMoveSpeed);
+    SetMoveDirection({ moveDirection.x, -1.0f });
 }
 
 void Paddle::OnMoveUpReleased() noexcept
 {
     if (moveDirection.y > 0.0f)
     {
-        moveSpeed = 0.0f;
-        moveDirection.y = 0.0f;
+        SetMoveSpeed(0.0f);
+        SetMoveDirection({ moveDirection.x, 0.0f });
     }
 }
 
@@ -76,28 +67,28 @@ void Paddle::OnMoveDownReleased() noexcept
 {
     if (moveDirection.y < 0.0f)
     {
-        moveSpeed = 0.0f;
-        moveDirection.y = 0.0f;
+        SetMoveSpeed(0.0f);
+        SetMoveDirection({ moveDirection.x, 0.0f });
     }
 }
 
-GLuint MakePaddleFragmentShader() noexcept
+void Paddle::ApplyAction(PaddleAction action) noexcept
 {
-    constexpr auto kSource =
-    R"(
-
-    #version 330 core
-
-    out vec4 FragColor;
-
-    void main()
+    switch (action)
     {
-        FragColor = vec4(1.0, 1.0, 1.0, 1.0);
+    case PaddleAction::Up:
+        OnMoveUpPressed();
+        break;
+
+    case PaddleAction::Down:
+        OnMoveDownPressed();
+        break;
+
+    case PaddleAction::Stay:
+        OnMoveUpReleased();
+        OnMoveDownReleased();
+        break;
     }
-
-    )";
-
-    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
 }
 
 } // namespace lepong
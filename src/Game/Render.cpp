@@ -0,0 +1,69 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Graphics/Quad.h"
+
+#include "lepong/Game/Render.h"
+
+namespace lepong
+{
+
+void RenderBall(const Ball& ball, const Graphics::Mesh& texturedQuad, GLuint program) noexcept
+{
+    const auto kDiameter = ball.radius * 2.0f;
+    Graphics::DrawQuad(texturedQuad, Vector2f{ kDiameter, kDiameter }, ball.position, program);
+}
+
+void RenderPaddle(const Paddle& paddle, const Graphics::Mesh& quad, GLuint program) noexcept
+{
+    Graphics::DrawQuad(quad, paddle.size, paddle.position, program);
+}
+
+GLuint MakeBallFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    in vec2 vTextureCoords;
+
+    out vec4 FragColor;
+
+    void main()
+    {
+        vec2 textureCoordsCentered = vTextureCoords * 2.0 - vec2(1.0);
+        float squareDistanceToCenter = dot(textureCoordsCentered, textureCoordsCentered);
+
+        // Simple glow.
+        float intensity = 1.0 - pow(squareDistanceToCenter, 3.0);
+
+        FragColor = vec4(intensity);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
+GLuint MakePaddleFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    out vec4 FragColor;
+
+    void main()
+    {
+        FragColor = vec4(1.0, 1.0, 1.0, 1.0);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
+} // namespace lepong
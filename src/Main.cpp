@@ -2,10 +2,30 @@
 // Created by lepouki on 10/12/2020.
 //
 
+#include <cstdio>
+#include <cstring>
+
 #include "lepong/lepong.h"
 
-int main()
+// usage: lepong [--record]
+//
+// --record saves the run to lepong.lprp and lepong.lptl in the working directory, see lepong::SetRecording.
+
+int main(int argc, char** argv)
 {
+    for (auto i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--record"))
+        {
+            lepong::SetRecording(true);
+        }
+        else
+        {
+            std::fputs("usage: lepong [--record]\n", stderr);
+            return -1;
+        }
+    }
+
     LEPONG_CHECK_OR_RETURN_VAL(lepong::Init(), -1);
 
     lepong::Run();
@@ -0,0 +1,146 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cmath>
+#include <limits>
+
+#include "lepong/Check.h"
+#include "lepong/Math/Collision.h"
+
+namespace lepong
+{
+
+///
+/// Clips the [enter, exit] time range with the slab of the provided axis.<br>
+/// If the slab is entered last so far, <i>normal</i> is set to the normal of the face it is entered through.
+///
+/// \return Whether the point can be inside the slab at all.
+///
+LEPONG_NODISCARD static bool ClipSlab(
+    float start, float motion, float halfExtent, const Vector2f& axis,
+    float& enter, float& exit, Vector2f& normal) noexcept;
+
+///
+/// Sweeps the point along <i>motion</i> against a circle.
+///
+/// \return Whether the point enters the circle during the motion, <i>time</i> is set if so.
+///
+LEPONG_NODISCARD static bool SweepPointCircle(
+    const Vector2f& start, const Vector2f& motion, const Vector2f& circleCenter, float radius, float& time) noexcept;
+
+bool SweepCircleAabb(
+    const Vector2f& center, float radius, const Vector2f& motion,
+    const Vector2f& boxCenter, const Vector2f& boxHalfSize, SweepHit& hit) noexcept
+{
+    // Work relative to the box center, the circle is a point and the box is grown by the radius.
+    const auto kStart = center - boxCenter;
+    const Vector2f kGrown = { boxHalfSize.x + radius, boxHalfSize.y + radius };
+
+    auto enter = -std::numeric_limits<float>::infinity();
+    auto exit = std::numeric_limits<float>::infinity();
+
+    Vector2f faceNormal;
+
+    LEPONG_CHECK_OR_RETURN_VAL(ClipSlab(kStart.x, motion.x, kGrown.x, { 1.0f, 0.0f }, enter, exit, faceNormal), false);
+    LEPONG_CHECK_OR_RETURN_VAL(ClipSlab(kStart.y, motion.y, kGrown.y, { 0.0f, 1.0f }, enter, exit, faceNormal), false);
+    LEPONG_CHECK_OR_RETURN_VAL(enter <= exit && exit >= 0.0f && enter <= 1.0f, false);
+
+    if (enter < 0.0f)
+    {
+        // Starting inside the grown box is only allowed in a corner, outside of the rounded part.
+        const Vector2f kClosest =
+        {
+            std::fmax(-boxHalfSize.x, std::fmin(kStart.x, boxHalfSize.x)),
+            std::fmax(-boxHalfSize.y, std::fmin(kStart.y, boxHalfSize.y))
+        };
+
+        LEPONG_CHECK_OR_RETURN_VAL((kStart - kClosest).SquareMag() > radius * radius, false);
+
+        enter = 0.0f;
+    }
+
+    const auto kEntry = kStart + motion * enter;
+
+    const auto kOutsideX = std::fabs(kEntry.x) > boxHalfSize.x;
+    const auto kOutsideY = std::fabs(kEntry.y) > boxHalfSize.y;
+
+    if (kOutsideX && kOutsideY)
+    {
+        // The grown box is entered through one of its corners, which are really quarter circles.
+        const Vector2f kCorner =
+        {
+            std::copysign(boxHalfSize.x, kEntry.x),
+            std::copysign(boxHalfSize.y, kEntry.y)
+        };
+
+        auto time = 0.0f;
+        LEPONG_CHECK_OR_RETURN_VAL(SweepPointCircle(kStart, motion, kCorner, radius, time), false);
+
+        hit.time = time;
+        hit.normal = Normalize(kStart + motion * time - kCorner);
+    }
+    else
+    {
+        hit.time = enter;
+        hit.normal = faceNormal;
+    }
+
+    return true;
+}
+
+bool ClipSlab(
+    float start, float motion, float halfExtent, const Vector2f& axis,
+    float& enter, float& exit, Vector2f& normal) noexcept
+{
+    if (motion == 0.0f)
+    {
+        // Parallel to the slab, either always inside or never.
+        return std::fabs(start) <= halfExtent;
+    }
+
+    auto nearTime = (-halfExtent - start) / motion;
+    auto farTime = (halfExtent - start) / motion;
+
+    // Moving toward positive values enters through the negative face.
+    auto sign = -1.0f;
+
+    if (nearTime > farTime)
+    {
+        const auto kNearTime = nearTime;
+        nearTime = farTime;
+        farTime = kNearTime;
+
+        sign = 1.0f;
+    }
+
+    if (nearTime > enter)
+    {
+        enter = nearTime;
+        normal = axis * sign;
+    }
+
+    exit = std::fmin(exit, farTime);
+    return true;
+}
+
+bool SweepPointCircle(
+    const Vector2f& start, const Vector2f& motion, const Vector2f& circleCenter, float radius, float& time) noexcept
+{
+    // Solves |start + motion * t - center|^2 = radius^2 for the smallest t.
+    const auto kOffset = start - circleCenter;
+
+    const auto kA = motion.SquareMag();
+    const auto kB = (kOffset.x * motion.x) + (kOffset.y * motion.y);
+    const auto kC = kOffset.SquareMag() - radius * radius;
+
+    LEPONG_CHECK_OR_RETURN_VAL(kA > 0.0f, false);
+
+    const auto kDiscriminant = kB * kB - kA * kC;
+    LEPONG_CHECK_OR_RETURN_VAL(kDiscriminant >= 0.0f, false);
+
+    time = (-kB - std::sqrt(kDiscriminant)) / kA;
+    return time >= 0.0f && time <= 1.0f;
+}
+
+} // namespace lepong
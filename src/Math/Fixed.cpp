@@ -0,0 +1,63 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Math/Fixed.h"
+
+namespace lepong
+{
+
+///
+/// \return The integer square root of <i>value</i> rounded down, one result bit at a time.
+///
+LEPONG_NODISCARD static std::uint64_t IntegerSqrt(std::uint64_t value) noexcept
+{
+    std::uint64_t result = 0;
+    std::uint64_t bit = std::uint64_t{ 1 } << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+
+    while (bit)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+
+        bit >>= 2;
+    }
+
+    return result;
+}
+
+Fixed Sqrt(Fixed value) noexcept
+{
+    if (value <= 0)
+    {
+        return 0;
+    }
+
+    // sqrt(raw / 2^16) * 2^16 = sqrt(raw * 2^16).
+    const auto kScaled = static_cast<std::uint64_t>(value.Raw()) << Fixed::skFractionBits;
+    return Fixed::FromRaw(static_cast<std::int32_t>(IntegerSqrt(kScaled)));
+}
+
+Fixed Hypot(Fixed x, Fixed y) noexcept
+{
+    const auto kX = static_cast<std::int64_t>(x.Raw());
+    const auto kY = static_cast<std::int64_t>(y.Raw());
+
+    // The squares are in Q32.32 so their square root is directly in Q16.16.
+    const auto kSquareSum = static_cast<std::uint64_t>(kX * kX) + static_cast<std::uint64_t>(kY * kY);
+    return Fixed::FromRaw(static_cast<std::int32_t>(IntegerSqrt(kSquareSum)));
+}
+
+} // namespace lepong
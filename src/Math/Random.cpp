@@ -0,0 +1,66 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Math/Random.h"
+
+namespace lepong
+{
+
+// The blocks are independent so the loops below have no carried dependency and the compiler can spread consecutive
+// blocks over SIMD lanes.
+
+template<typename Convert>
+static void FillBlocks(Philox4x32& generator, std::size_t count, Convert convert) noexcept
+{
+    const auto kFullBlocks = count / 4;
+    const auto kFirst = generator.counter;
+
+    for (std::size_t b = 0; b < kFullBlocks; ++b)
+    {
+        const auto kBlock = Philox4x32::Generate(kFirst + b, generator.stream, generator.key);
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            convert(b * 4 + i, kBlock.values[i]);
+        }
+    }
+
+    if (count % 4)
+    {
+        const auto kBlock = Philox4x32::Generate(kFirst + kFullBlocks, generator.stream, generator.key);
+
+        for (std::size_t i = 0; i < count % 4; ++i)
+        {
+            convert(kFullBlocks * 4 + i, kBlock.values[i]);
+        }
+    }
+
+    generator.Advance((count + 3) / 4);
+}
+
+void Philox4x32::Fill(std::uint32_t* values, std::size_t count) noexcept
+{
+    FillBlocks(*this, count, [values](std::size_t i, std::uint32_t value)
+    {
+        values[i] = value;
+    });
+}
+
+void Philox4x32::FillFloats(float* values, std::size_t count) noexcept
+{
+    FillBlocks(*this, count, [values](std::size_t i, std::uint32_t value)
+    {
+        values[i] = static_cast<float>(value >> 8u) * (1.0f / 16777216.0f);
+    });
+}
+
+void Philox4x32::FillSigns(float* values, std::size_t count) noexcept
+{
+    FillBlocks(*this, count, [values](std::size_t i, std::uint32_t value)
+    {
+        values[i] = (value >> 31u) ? 1.0f : -1.0f;
+    });
+}
+
+} // namespace lepong
@@ -0,0 +1,77 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Cpu.h"
+
+#include "VectorBatchKernel.h"
+
+namespace lepong
+{
+
+static_assert(sizeof(Vector2f) == 2 * sizeof(float), "The packs load vectors as consecutive floats");
+
+// Each function first lets the widest kernel process what it can, then the 4 wide kernel, then finishes the
+// remaining elements one at a time.
+
+#if defined(LEPONG_X86_KERNELS)
+#define LEPONG_VECTOR_BATCH_AVX2(call) \
+    (Cpu::HasAVX2() ? VectorBatchKernels::call : 0)
+#else
+#define LEPONG_VECTOR_BATCH_AVX2(call) \
+    0
+#endif
+
+void Normalize(const Vector2f* in, Vector2f* out, std::size_t count) noexcept
+{
+    auto i = LEPONG_VECTOR_BATCH_AVX2(NormalizeAVX2(in, out, count));
+    i += VectorBatchKernels::Normalize<Vector2x4f>(in + i, out + i, count - i);
+
+    for (; i < count; ++i)
+    {
+        out[i] = Normalize(in[i]);
+    }
+}
+
+void NormalizeFast(const Vector2f* in, Vector2f* out, std::size_t count) noexcept
+{
+    auto i = LEPONG_VECTOR_BATCH_AVX2(NormalizeFastAVX2(in, out, count));
+    i += VectorBatchKernels::NormalizeFast<Vector2x4f>(in + i, out + i, count - i);
+
+    for (; i < count; ++i)
+    {
+        out[i] = in[i] * InverseSqrtFast(in[i].SquareMag());
+    }
+}
+
+void SquareMag(const Vector2f* in, float* out, std::size_t count) noexcept
+{
+    auto i = LEPONG_VECTOR_BATCH_AVX2(SquareMagAVX2(in, out, count));
+    i += VectorBatchKernels::SquareMag<Vector2x4f>(in + i, out + i, count - i);
+
+    for (; i < count; ++i)
+    {
+        out[i] = in[i].SquareMag();
+    }
+}
+
+void MultiplyAdd(Vector2f* positions, const Vector2f* directions, const float* speeds, float delta, std::size_t count) noexcept
+{
+    auto i = LEPONG_VECTOR_BATCH_AVX2(MultiplyAddAVX2(positions, directions, speeds, delta, count));
+    i += VectorBatchKernels::MultiplyAdd<Vector2x4f>(positions + i, directions + i, speeds + i, delta, count - i);
+
+    for (; i < count; ++i)
+    {
+        positions[i] += directions[i] * speeds[i] * delta;
+    }
+}
+
+float InverseSqrtFast(float s) noexcept
+{
+    float results[Float4::skWidth];
+    InverseSqrtFast(Float4::Broadcast(s)).Store(results);
+
+    return results[0];
+}
+
+} // namespace lepong
@@ -0,0 +1,30 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "VectorBatchKernel.h"
+
+namespace lepong::VectorBatchKernels
+{
+
+std::size_t NormalizeAVX2(const Vector2f* in, Vector2f* out, std::size_t count) noexcept
+{
+    return Normalize<Vector2x8f>(in, out, count);
+}
+
+std::size_t NormalizeFastAVX2(const Vector2f* in, Vector2f* out, std::size_t count) noexcept
+{
+    return NormalizeFast<Vector2x8f>(in, out, count);
+}
+
+std::size_t SquareMagAVX2(const Vector2f* in, float* out, std::size_t count) noexcept
+{
+    return SquareMag<Vector2x8f>(in, out, count);
+}
+
+std::size_t MultiplyAddAVX2(Vector2f* positions, const Vector2f* directions, const float* speeds, float delta, std::size_t count) noexcept
+{
+    return MultiplyAdd<Vector2x8f>(positions, directions, speeds, delta, count);
+}
+
+} // namespace lepong::VectorBatchKernels
@@ -0,0 +1,80 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Math/Vector2Wide.h"
+#include "lepong/Math/VectorBatch.h"
+
+// The array operations written once for any Vector2xN. Each function processes whole packs only and returns how
+// many elements it processed, the caller takes care of the rest.
+
+namespace lepong::VectorBatchKernels
+{
+
+template<typename Pack>
+std::size_t Normalize(const Vector2f* in, Vector2f* out, std::size_t count) noexcept
+{
+    std::size_t i = 0;
+
+    for (; i + Pack::skWidth <= count; i += Pack::skWidth)
+    {
+        lepong::Normalize(Pack::Load(in + i)).Store(out + i);
+    }
+
+    return i;
+}
+
+template<typename Pack>
+std::size_t NormalizeFast(const Vector2f* in, Vector2f* out, std::size_t count) noexcept
+{
+    std::size_t i = 0;
+
+    for (; i + Pack::skWidth <= count; i += Pack::skWidth)
+    {
+        lepong::NormalizeFast(Pack::Load(in + i)).Store(out + i);
+    }
+
+    return i;
+}
+
+template<typename Pack>
+std::size_t SquareMag(const Vector2f* in, float* out, std::size_t count) noexcept
+{
+    std::size_t i = 0;
+
+    for (; i + Pack::skWidth <= count; i += Pack::skWidth)
+    {
+        Pack::Load(in + i).SquareMag().Store(out + i);
+    }
+
+    return i;
+}
+
+template<typename Pack>
+std::size_t MultiplyAdd(Vector2f* positions, const Vector2f* directions, const float* speeds, float delta, std::size_t count) noexcept
+{
+    using Lane = decltype(Pack::x);
+
+    const auto kDelta = Lane::Broadcast(delta);
+    std::size_t i = 0;
+
+    for (; i + Pack::skWidth <= count; i += Pack::skWidth)
+    {
+        auto position = Pack::Load(positions + i);
+        position += Pack::Load(directions + i) * Lane::Load(speeds + i) * kDelta;
+        position.Store(positions + i);
+    }
+
+    return i;
+}
+
+// Implemented in VectorBatchAVX2.cpp, only called when the CPU supports AVX2.
+
+std::size_t NormalizeAVX2(const Vector2f* in, Vector2f* out, std::size_t count) noexcept;
+std::size_t NormalizeFastAVX2(const Vector2f* in, Vector2f* out, std::size_t count) noexcept;
+std::size_t SquareMagAVX2(const Vector2f* in, float* out, std::size_t count) noexcept;
+std::size_t MultiplyAddAVX2(Vector2f* positions, const Vector2f* directions, const float* speeds, float delta, std::size_t count) noexcept;
+
+} // namespace lepong::VectorBatchKernels
@@ -0,0 +1,206 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <chrono>
+
+#include "lepong/Check.h"
+#include "lepong/Net/RollbackSession.h"
+
+namespace lepong::Net
+{
+
+// Packet layout, little endian:
+//   u32 ack + 1 (0 when no remote input was received yet)
+//   u32 first tick
+//   u8  input count
+//   u8  inputs[count]
+
+static constexpr std::size_t skHeaderSize = 9;
+
+// Every unacknowledged input is sent again in each packet so that lost packets don't matter, up to this many.
+static constexpr std::int64_t skMaxInputsPerPacket = 128;
+
+// The snapshots and the input history must cover every tick that can be rolled back.
+static constexpr unsigned skMaxPrediction = 64;
+
+static void WriteU32(std::uint8_t* data, std::uint32_t value) noexcept
+{
+    for (auto i = 0; i < 4; ++i)
+    {
+        data[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+}
+
+LEPONG_NODISCARD static std::uint32_t ReadU32(const std::uint8_t* data) noexcept
+{
+    std::uint32_t value = 0;
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        value |= static_cast<std::uint32_t>(data[i]) << (8 * i);
+    }
+
+    return value;
+}
+
+RollbackSession::RollbackSession(const RollbackSettings& settings, Transport& transport, const Match& match) noexcept
+    : mSettings(settings)
+    , mTransport(transport)
+    , mMatch(match)
+    , mSnapshots(std::min(settings.maxPrediction, skMaxPrediction) + 2u)
+{
+    mSettings.maxPrediction = std::min(mSettings.maxPrediction, skMaxPrediction);
+    mSettings.inputDelay = std::min(mSettings.inputDelay, skMaxPrediction);
+
+    // The first ticks run before any local input could be delayed into them.
+    for (std::int64_t t = 0; t < static_cast<std::int64_t>(mSettings.inputDelay); ++t)
+    {
+        mLocalInputs[t & skInputMask] = PaddleAction::Stay;
+        mLastLocalInput = t;
+    }
+}
+
+bool RollbackSession::AdvanceFrame(PaddleAction localAction) noexcept
+{
+    ++mFrame;
+    const auto kNow = static_cast<double>(mFrame) * mSettings.tickDelta;
+
+    mRollbackTick = mTick;
+    ReceiveInputs(kNow);
+
+    if (mRollbackTick < mTick)
+    {
+        Rollback(mRollbackTick);
+    }
+
+    if (mTick - mConfirmedRemote > static_cast<std::int64_t>(mSettings.maxPrediction))
+    {
+        ++mStats.stalls;
+
+        // The remote peer may be waiting for our inputs too.
+        SendInputs(kNow);
+        return false;
+    }
+
+    mLastLocalInput = mTick + mSettings.inputDelay;
+    mLocalInputs[mLastLocalInput & skInputMask] = localAction;
+
+    SimulateTick(mTick);
+    ++mTick;
+
+    SendInputs(kNow);
+    return true;
+}
+
+void RollbackSession::ReceiveInputs(double now) noexcept
+{
+    Packet packet;
+
+    while (mTransport.Receive(packet, now))
+    {
+        ++mStats.packetsReceived;
+
+        if (packet.size() < skHeaderSize || packet.size() != skHeaderSize + packet[8])
+        {
+            continue;
+        }
+
+        mRemoteAck = std::max(mRemoteAck, static_cast<std::int64_t>(ReadU32(packet.data())) - 1);
+
+        const auto kFirstTick = static_cast<std::int64_t>(ReadU32(packet.data() + 4));
+        const auto kCount = static_cast<std::int64_t>(packet[8]);
+
+        // Only inputs right after the last confirmed one are taken so that the confirmed ticks have no holes.
+        for (auto t = std::max(kFirstTick, mConfirmedRemote + 1); t < kFirstTick + kCount && t == mConfirmedRemote + 1; ++t)
+        {
+            const auto kInput = static_cast<PaddleAction>(packet[skHeaderSize + (t - kFirstTick)]);
+
+            mRemoteInputs[t & skInputMask] = kInput;
+            mConfirmedRemote = t;
+
+            if (t < mTick && mUsedRemoteInputs[t & skInputMask] != kInput)
+            {
+                mRollbackTick = std::min(mRollbackTick, t);
+            }
+        }
+    }
+}
+
+void RollbackSession::SendInputs(double now) noexcept
+{
+    const auto kFirstTick = std::max(mRemoteAck + 1, mLastLocalInput - skMaxInputsPerPacket + 1);
+    const auto kCount = mLastLocalInput - kFirstTick + 1;
+
+    LEPONG_CHECK_OR_RETURN(kCount > 0);
+
+    std::uint8_t data[skHeaderSize + skMaxInputsPerPacket];
+
+    WriteU32(data, static_cast<std::uint32_t>(mConfirmedRemote + 1));
+    WriteU32(data + 4, static_cast<std::uint32_t>(kFirstTick));
+    data[8] = static_cast<std::uint8_t>(kCount);
+
+    for (std::int64_t i = 0; i < kCount; ++i)
+    {
+        data[skHeaderSize + i] = static_cast<std::uint8_t>(mLocalInputs[(kFirstTick + i) & skInputMask]);
+    }
+
+    mTransport.Send(data, skHeaderSize + static_cast<std::size_t>(kCount), now);
+    ++mStats.packetsSent;
+}
+
+void RollbackSession::Rollback(std::int64_t tick) noexcept
+{
+    const auto kStart = std::chrono::steady_clock::now();
+
+    // Can't fail: a prediction is never older than maxPrediction ticks and the ring keeps more than that.
+    LEPONG_CHECK_OR_RETURN(mSnapshots.Restore(static_cast<std::uint64_t>(tick), mMatch));
+
+    for (auto t = tick; t < mTick; ++t)
+    {
+        SimulateTick(t);
+    }
+
+    const auto kSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - kStart).count();
+    const auto kTicks = static_cast<unsigned>(mTick - tick);
+
+    ++mStats.rollbacks;
+    mStats.resimulatedTicks += kTicks;
+    mStats.maxRollbackTicks = std::max(mStats.maxRollbackTicks, kTicks);
+    mStats.rollbackTime += kSeconds;
+    mStats.maxRollbackTime = std::max(mStats.maxRollbackTime, kSeconds);
+}
+
+void RollbackSession::SimulateTick(std::int64_t tick) noexcept
+{
+    mSnapshots.Save(static_cast<std::uint64_t>(tick), mMatch);
+
+    if (!mMatch.playing)
+    {
+        mMatch.Launch();
+    }
+
+    const auto kRemoteInput = GetRemoteInput(tick);
+    mUsedRemoteInputs[tick & skInputMask] = kRemoteInput;
+
+    const auto kLocal = mSettings.localPlayer ? 1u : 0u;
+
+    mMatch.GetPaddle(kLocal).ApplyAction(mLocalInputs[tick & skInputMask]);
+    mMatch.GetPaddle(1u - kLocal).ApplyAction(kRemoteInput);
+
+    mMatch.Update(mSettings.tickDelta);
+}
+
+PaddleAction RollbackSession::GetRemoteInput(std::int64_t tick) const noexcept
+{
+    if (tick <= mConfirmedRemote)
+    {
+        return mRemoteInputs[tick & skInputMask];
+    }
+
+    // Predict that the remote player keeps doing the same thing.
+    return mConfirmedRemote >= 0 ? mRemoteInputs[mConfirmedRemote & skInputMask] : PaddleAction::Stay;
+}
+
+} // namespace lepong::Net
@@ -0,0 +1,418 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#define LEPONG_HAS_PAUSE
+#endif
+
+#include <atomic>
+#include <new>
+#include <thread>
+
+#include "lepong/Check.h"
+#include "lepong/Net/StepChannel.h"
+
+namespace lepong::Net
+{
+
+static constexpr std::uint32_t skMagic = 0x4353504Cu; // "LPSC"
+static constexpr std::uint32_t skVersion = 1;
+
+static constexpr std::size_t skAlignment = 64;
+
+// About as long as sleeping and being woken takes when the other side has a CPU of its own.
+static constexpr unsigned skSpinCount = 256;
+
+// The other side can't run while this one spins on a single CPU, it yields a few times instead.
+static constexpr unsigned skYieldCount = 16;
+
+// A side closing while the other is about to sleep may wake it too early, it then notices within this time.
+static constexpr long skSleepNanoseconds = 100'000'000;
+
+using Word = std::atomic<std::uint32_t>;
+
+// The rings are used from two processes, the words must not be locks living in one of them.
+static_assert(Word::is_always_lock_free && sizeof(Word) == sizeof(std::uint32_t), "Shared words must be plain integers");
+
+///
+/// A ring of up to <code>skSlotCount</code> entries. The producer and the consumer fields are on their own cache
+/// lines so that the sides don't keep taking them from each other.
+///
+struct StepChannel::Ring
+{
+    // Written by the producer.
+    alignas(skAlignment) Word head;
+    std::uint32_t entries[skSlotCount];
+
+    // Written by the consumer, which sets sleeping before waiting on head.
+    alignas(skAlignment) Word tail;
+    Word sleeping;
+};
+
+struct StepChannel::Header
+{
+    // Set last by the simulator, once the rest is.
+    Word magic;
+    std::uint32_t version;
+
+    std::uint32_t envCount;
+    std::uint32_t observationSize;
+    std::uint64_t size;
+
+    // Set by the first side to leave.
+    Word closed;
+
+    Ring commands;
+    Ring results;
+};
+
+///
+/// Sleeps until <i>word</i> changes from <i>value</i>, or a little longer.
+///
+static void Sleep(Word& word, std::uint32_t value) noexcept
+{
+#if defined(__linux__)
+    const timespec kTimeout = { 0, skSleepNanoseconds };
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, value, &kTimeout, nullptr, 0);
+#else
+    static_cast<void>(word);
+    static_cast<void>(value);
+
+    std::this_thread::yield();
+#endif
+}
+
+static void Wake(Word& word) noexcept
+{
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#else
+    static_cast<void>(word);
+#endif
+}
+
+///
+/// Lets the other side run while spinning.
+///
+static void Relax(bool singleCpu) noexcept
+{
+#if defined(LEPONG_HAS_PAUSE)
+    if (!singleCpu)
+    {
+        _mm_pause();
+        return;
+    }
+#else
+    static_cast<void>(singleCpu);
+#endif
+
+    std::this_thread::yield();
+}
+
+LEPONG_NODISCARD static std::size_t Align(std::size_t size) noexcept
+{
+    return (size + skAlignment - 1) & ~(skAlignment - 1);
+}
+
+LEPONG_NODISCARD static std::string GetSharedMemoryName(const char* name) noexcept
+{
+#if defined(_WIN32)
+    return name;
+#else
+    // POSIX shared memory names start with a slash.
+    return name[0] == '/' ? std::string(name) : '/' + std::string(name);
+#endif
+}
+
+StepChannel::~StepChannel() noexcept
+{
+    Close();
+}
+
+bool StepChannel::Create(const char* name, std::uint32_t envCount, std::uint32_t observationSize) noexcept
+{
+    Close();
+
+    LEPONG_CHECK_OR_RETURN_VAL(name && *name && envCount && observationSize, false);
+
+    mSize = SetLayout(envCount, observationSize);
+    LEPONG_CHECK_OR_RETURN_VAL(Map(name, true), false);
+
+    mCreator = true;
+    mName = name;
+
+    auto* header = new (mData) Header();
+
+    header->version = skVersion;
+    header->envCount = envCount;
+    header->observationSize = observationSize;
+    header->size = mSize;
+    header->magic.store(skMagic, std::memory_order_release);
+
+    return true;
+}
+
+bool StepChannel::Open(const char* name) noexcept
+{
+    Close();
+
+    LEPONG_CHECK_OR_RETURN_VAL(name && *name, false);
+    LEPONG_CHECK_OR_RETURN_VAL(Map(name, false), false);
+
+    if (mSize >= sizeof(Header))
+    {
+        const auto& kHeader = GetHeader();
+
+        const auto kReady =
+            kHeader.magic.load(std::memory_order_acquire) == skMagic &&
+            kHeader.version == skVersion &&
+            !kHeader.closed.load(std::memory_order_acquire);
+
+        if (kReady && kHeader.envCount && kHeader.observationSize)
+        {
+            const auto kSize = SetLayout(kHeader.envCount, kHeader.observationSize);
+
+            if (kSize == kHeader.size && kSize <= mSize)
+            {
+                return true;
+            }
+        }
+    }
+
+    // This side never joined the channel, it must not close it for the side that owns it.
+    Unmap();
+    return false;
+}
+
+void StepChannel::Close() noexcept
+{
+    if (mData)
+    {
+        auto& header = GetHeader();
+
+        // Whoever waits on the other side must not wait for this side anymore.
+        header.closed.store(1u, std::memory_order_seq_cst);
+        Wake(header.commands.head);
+        Wake(header.results.head);
+    }
+
+    Unmap();
+}
+
+void StepChannel::Unmap() noexcept
+{
+    if (mData)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(mData);
+#else
+        munmap(mData, mSize);
+#endif
+    }
+
+#if defined(_WIN32)
+    if (mMapping)
+    {
+        CloseHandle(mMapping);
+    }
+#else
+    if (mCreator)
+    {
+        shm_unlink(GetSharedMemoryName(mName.c_str()).c_str());
+    }
+#endif
+
+    mData = nullptr;
+    mSize = 0;
+    mMapping = nullptr;
+    mCreator = false;
+    mName.clear();
+    mEnvCount = 0;
+    mObservationSize = 0;
+}
+
+bool StepChannel::Submit(StepCommand command, std::uint32_t slot) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(mData && slot < skSlotCount, false);
+    return Push(GetHeader().commands, (static_cast<std::uint32_t>(command) << 8u) | slot);
+}
+
+bool StepChannel::WaitResult(std::uint32_t& slot) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(mData, false);
+    return Pop(GetHeader().results, slot);
+}
+
+bool StepChannel::WaitCommand(StepCommand& command, std::uint32_t& slot) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(mData, false);
+
+    std::uint32_t entry;
+    LEPONG_CHECK_OR_RETURN_VAL(Pop(GetHeader().commands, entry), false);
+
+    command = static_cast<StepCommand>(entry >> 8u);
+    slot = entry & 0xFFu;
+
+    return slot < skSlotCount && command <= StepCommand::Close;
+}
+
+void StepChannel::Complete(std::uint32_t slot) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mData);
+    static_cast<void>(Push(GetHeader().results, slot));
+}
+
+std::size_t StepChannel::SetLayout(std::uint32_t envCount, std::uint32_t observationSize) noexcept
+{
+    const auto kEnvCount = static_cast<std::size_t>(envCount);
+
+    mEnvCount = envCount;
+    mObservationSize = observationSize;
+
+    mRewardsOffset = Align(kEnvCount * sizeof(std::int32_t));
+    mDonesOffset = mRewardsOffset + Align(kEnvCount * sizeof(float));
+    mObservationsOffset = mDonesOffset + Align(kEnvCount);
+    mSlotSize = mObservationsOffset + Align(kEnvCount * observationSize);
+    mSlotsOffset = Align(sizeof(Header));
+
+    return mSlotsOffset + skSlotCount * mSlotSize;
+}
+
+bool StepChannel::Map(const char* name, bool create) noexcept
+{
+    const auto kName = GetSharedMemoryName(name);
+
+#if defined(_WIN32)
+    const auto kSize = static_cast<unsigned long long>(mSize);
+
+    mMapping = create
+        ? CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(kSize >> 32u), static_cast<DWORD>(kSize), kName.c_str())
+        : OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, kName.c_str());
+
+    LEPONG_CHECK_OR_RETURN_VAL(mMapping, false);
+
+    mData = static_cast<std::uint8_t*>(MapViewOfFile(mMapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+    LEPONG_CHECK_OR_RETURN_VAL(mData, false);
+
+    if (!create)
+    {
+        MEMORY_BASIC_INFORMATION information = {};
+        VirtualQuery(mData, &information, sizeof(information));
+
+        mSize = information.RegionSize;
+    }
+#else
+    if (create)
+    {
+        shm_unlink(kName.c_str());
+    }
+
+    const auto kFile = create
+        ? shm_open(kName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600)
+        : shm_open(kName.c_str(), O_RDWR, 0);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kFile >= 0, false);
+
+    struct stat status = {};
+
+    const auto kHasSize = create
+        ? ftruncate(kFile, static_cast<off_t>(mSize)) == 0
+        : fstat(kFile, &status) == 0 && status.st_size > 0;
+
+    if (!create)
+    {
+        mSize = static_cast<std::size_t>(status.st_size);
+    }
+
+    auto* data = kHasSize ? mmap(nullptr, mSize, PROT_READ | PROT_WRITE, MAP_SHARED, kFile, 0) : MAP_FAILED;
+
+    // The mapping keeps the shared memory open.
+    close(kFile);
+
+    if (data == MAP_FAILED)
+    {
+        if (create)
+        {
+            shm_unlink(kName.c_str());
+        }
+
+        return false;
+    }
+
+    mData = static_cast<std::uint8_t*>(data);
+#endif
+
+    return true;
+}
+
+bool StepChannel::Push(Ring& ring, std::uint32_t entry) noexcept
+{
+    const auto kHead = ring.head.load(std::memory_order_relaxed);
+    LEPONG_CHECK_OR_RETURN_VAL(kHead - ring.tail.load(std::memory_order_acquire) < skSlotCount, false);
+
+    ring.entries[kHead % skSlotCount] = entry;
+
+    // Paired with the consumer setting sleeping then reading head, one of the two sides sees the other.
+    ring.head.store(kHead + 1u, std::memory_order_seq_cst);
+
+    if (ring.sleeping.load(std::memory_order_seq_cst))
+    {
+        Wake(ring.head);
+    }
+
+    return !GetHeader().closed.load(std::memory_order_acquire);
+}
+
+bool StepChannel::Pop(Ring& ring, std::uint32_t& entry) noexcept
+{
+    static const auto skSingleCpu = std::thread::hardware_concurrency() <= 1u;
+
+    const auto& kHeader = GetHeader();
+    const auto kTail = ring.tail.load(std::memory_order_relaxed);
+    const auto kSpinCount = skSingleCpu ? skYieldCount : skSpinCount;
+
+    for (auto spin = 0u; ring.head.load(std::memory_order_acquire) == kTail; ++spin)
+    {
+        LEPONG_CHECK_OR_RETURN_VAL(!kHeader.closed.load(std::memory_order_acquire), false);
+
+        if (mWait == StepWait::Poll || spin < kSpinCount)
+        {
+            Relax(skSingleCpu);
+            continue;
+        }
+
+        ring.sleeping.store(1u, std::memory_order_seq_cst);
+
+        if (ring.head.load(std::memory_order_seq_cst) == kTail && !kHeader.closed.load(std::memory_order_seq_cst))
+        {
+            Sleep(ring.head, kTail);
+        }
+
+        ring.sleeping.store(0u, std::memory_order_relaxed);
+    }
+
+    entry = ring.entries[kTail % skSlotCount];
+    ring.tail.store(kTail + 1u, std::memory_order_release);
+
+    return true;
+}
+
+} // namespace lepong::Net
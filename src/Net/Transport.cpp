@@ -0,0 +1,64 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+
+#include "lepong/Check.h"
+#include "lepong/Net/Transport.h"
+
+namespace lepong::Net
+{
+
+SimulatedLink::SimulatedLink(const LinkConditions& conditions) noexcept
+    : mConditions(conditions)
+    , mRandom(conditions.seed)
+{
+}
+
+void SimulatedLink::Push(const std::uint8_t* data, std::size_t size, double now) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mConditions.loss <= 0.0f || mRandom.NextFloat() >= mConditions.loss);
+
+    const auto kDueTime = now + mConditions.latency + mConditions.jitter * mRandom.NextFloat();
+
+    // Packets due at the same time keep their order.
+    const auto kWhere = std::upper_bound(mPending.begin(), mPending.end(), kDueTime,
+        [](double time, const Pending& pending) { return time < pending.dueTime; });
+
+    mPending.insert(kWhere, { kDueTime, Packet(data, data + size) });
+}
+
+bool SimulatedLink::Pop(Packet& packet, double now) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!mPending.empty() && mPending.front().dueTime <= now, false);
+
+    packet = std::move(mPending.front().packet);
+    mPending.pop_front();
+
+    return true;
+}
+
+LoopbackTransport::LoopbackTransport(const LinkConditions& conditions) noexcept
+    : mOutgoing(conditions)
+{
+}
+
+void LoopbackTransport::Connect(LoopbackTransport& a, LoopbackTransport& b) noexcept
+{
+    a.mPeer = &b;
+    b.mPeer = &a;
+}
+
+void LoopbackTransport::Send(const std::uint8_t* data, std::size_t size, double now) noexcept
+{
+    mOutgoing.Push(data, size, now);
+}
+
+bool LoopbackTransport::Receive(Packet& packet, double now) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(mPeer, false);
+    return mPeer->mOutgoing.Pop(packet, now);
+}
+
+} // namespace lepong::Net
@@ -0,0 +1,149 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#if defined(_WIN32)
+#include <WinSock2.h>
+#include <WS2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+#include "lepong/Check.h"
+#include "lepong/Net/UdpTransport.h"
+
+namespace lepong::Net
+{
+
+// Bigger than any packet a session sends.
+static constexpr std::size_t skMaxPacketSize = 1024;
+
+#if defined(_WIN32)
+using SocketHandle = SOCKET;
+static const auto skInvalidSocket = static_cast<std::intptr_t>(INVALID_SOCKET);
+#else
+using SocketHandle = int;
+static constexpr std::intptr_t skInvalidSocket = -1;
+#endif
+
+LEPONG_NODISCARD static sockaddr_in MakeLoopbackAddress(std::uint16_t port) noexcept
+{
+    sockaddr_in address = {};
+
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    return address;
+}
+
+UdpTransport::UdpTransport(const LinkConditions& conditions) noexcept
+    : mOutgoing(conditions)
+    , mSocket(skInvalidSocket)
+{
+}
+
+UdpTransport::~UdpTransport() noexcept
+{
+    Close();
+}
+
+bool UdpTransport::Open(std::uint16_t localPort, std::uint16_t remotePort) noexcept
+{
+    Close();
+
+#if defined(_WIN32)
+    WSADATA data;
+    LEPONG_CHECK_OR_RETURN_VAL(WSAStartup(MAKEWORD(2, 2), &data) == 0, false);
+#endif
+
+    const auto kSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    mSocket = static_cast<std::intptr_t>(kSocket);
+
+    LEPONG_CHECK_OR_RETURN_VAL(mSocket != skInvalidSocket, false);
+
+    const auto kAddress = MakeLoopbackAddress(localPort);
+
+    if (bind(kSocket, reinterpret_cast<const sockaddr*>(&kAddress), sizeof(kAddress)) != 0)
+    {
+        Close();
+        return false;
+    }
+
+    // Receive must never wait.
+#if defined(_WIN32)
+    u_long nonBlocking = 1;
+    const auto kNonBlocking = ioctlsocket(kSocket, FIONBIO, &nonBlocking) == 0;
+#else
+    const auto kNonBlocking = fcntl(kSocket, F_SETFL, fcntl(kSocket, F_GETFL, 0) | O_NONBLOCK) == 0;
+#endif
+
+    if (!kNonBlocking)
+    {
+        Close();
+        return false;
+    }
+
+    mRemotePort = remotePort;
+    return true;
+}
+
+void UdpTransport::Close() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mSocket != skInvalidSocket);
+
+#if defined(_WIN32)
+    closesocket(static_cast<SocketHandle>(mSocket));
+    WSACleanup();
+#else
+    close(static_cast<SocketHandle>(mSocket));
+#endif
+
+    mSocket = skInvalidSocket;
+}
+
+void UdpTransport::Send(const std::uint8_t* data, std::size_t size, double now) noexcept
+{
+    mOutgoing.Push(data, size, now);
+    Flush(now);
+}
+
+bool UdpTransport::Receive(Packet& packet, double now) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(mSocket != skInvalidSocket, false);
+
+    Flush(now);
+
+    std::uint8_t buffer[skMaxPacketSize];
+
+    const auto kReceived = recvfrom(
+        static_cast<SocketHandle>(mSocket), reinterpret_cast<char*>(buffer), sizeof(buffer), 0, nullptr, nullptr);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kReceived > 0, false);
+
+    packet.assign(buffer, buffer + kReceived);
+    return true;
+}
+
+void UdpTransport::Flush(double now) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mSocket != skInvalidSocket);
+
+    const auto kAddress = MakeLoopbackAddress(mRemotePort);
+    Packet packet;
+
+    while (mOutgoing.Pop(packet, now))
+    {
+        // Lost if the socket buffer is full, like any UDP packet.
+        sendto(static_cast<SocketHandle>(mSocket), reinterpret_cast<const char*>(packet.data()),
+            static_cast<int>(packet.size()), 0, reinterpret_cast<const sockaddr*>(&kAddress), sizeof(kAddress));
+    }
+}
+
+} // namespace lepong::Net
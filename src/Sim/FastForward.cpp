@@ -0,0 +1,211 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cmath>
+#include <limits>
+
+#include "lepong/Check.h"
+#include "lepong/Sim/FastForward.h"
+#include "lepong/Sim/TrajectoryPredictor.h"
+
+namespace lepong
+{
+
+static constexpr auto skInfinity = std::numeric_limits<float>::infinity();
+
+static constexpr auto skArenaWidth = static_cast<float>(Match::skArenaSize.x);
+static constexpr auto skArenaHeight = static_cast<float>(Match::skArenaSize.y);
+
+// The range Paddle::CollideWithTerrain keeps the paddles in.
+static constexpr auto skPaddleMinTerrainOffset = Match::skPaddleSize.y * 0.1f;
+static constexpr auto skPaddleMinY = Match::skPaddleSize.y / 2.0f + skPaddleMinTerrainOffset;
+static constexpr auto skPaddleMaxY = skArenaHeight - Match::skPaddleSize.y / 2.0f - skPaddleMinTerrainOffset;
+
+// Ball::DoCollideWith accepts balls up to this far from the paddle center.
+static constexpr auto skPaddleReach = Match::skPaddleSize.y / 2.0f + Match::skPaddleSize.y * 0.1f;
+
+enum class Event
+{
+    None,
+    Wall,
+    PaddlePlane,
+    Side,
+    Decision
+};
+
+///
+/// \return The x the ball center is at when the ball touches the front of the paddle.
+///
+LEPONG_NODISCARD static float GetPaddlePlane(const Paddle& paddle, float radius) noexcept
+{
+    return paddle.position.x + (paddle.size.x / 2.0f + radius) * paddle.forward;
+}
+
+///
+/// \return The position of a paddle moving toward its target for the provided time.
+///
+LEPONG_NODISCARD static float MovePaddle(float y, float targetY, float time) noexcept
+{
+    const auto kMaxDistance = Paddle::skDefaultMoveSpeed * time;
+    const auto kDistance = targetY - y;
+
+    y = std::fabs(kDistance) <= kMaxDistance ? targetY : y + std::copysign(kMaxDistance, kDistance);
+    return std::fmax(skPaddleMinY, std::fmin(y, skPaddleMaxY));
+}
+
+///
+/// Asks both controllers for their commands.
+///
+static void Decide(const Match& match, const FastForwardSettings& settings, PaddleCommand (&commands)[2]) noexcept
+{
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        const auto& kController = settings.controllers[p];
+
+        commands[p] = kController.function
+            ? kController.function(match, p, kController.userData)
+            : PaddleCommand{ match.GetPaddle(p).position.y };
+    }
+}
+
+Side FastForwardPoint(Match& match, const FastForwardSettings& settings, FastForwardStats& stats) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(match.playing, Side::None);
+
+    auto& ball = match.ball;
+
+    PaddleCommand commands[2];
+    Decide(match, settings, commands);
+
+    auto elapsed = 0.0f;
+    auto nextDecision = settings.decisionInterval > 0.0f ? settings.decisionInterval : skInfinity;
+
+    // Set once the ball is past the plane of the paddle it moves toward, until it changes direction.
+    auto pastPlane = false;
+
+    while (elapsed < settings.maxTime)
+    {
+        const auto kVelocity = ball.moveDirection * ball.moveSpeed;
+
+        auto event = Event::None;
+        auto time = settings.maxTime - elapsed;
+
+        const auto kConsider = [&](float candidate, Event candidateEvent)
+        {
+            if (candidate >= 0.0f && candidate < time)
+            {
+                time = candidate;
+                event = candidateEvent;
+            }
+        };
+
+        if (kVelocity.y > 0.0f)
+        {
+            kConsider((skArenaHeight - ball.radius - ball.position.y) / kVelocity.y, Event::Wall);
+        }
+        else if (kVelocity.y < 0.0f)
+        {
+            kConsider((ball.radius - ball.position.y) / kVelocity.y, Event::Wall);
+        }
+
+        const auto kTarget = kVelocity.x < 0.0f ? 0u : 1u;
+        const auto& kTargetPaddle = match.GetPaddle(kTarget);
+
+        if (kVelocity.x != 0.0f)
+        {
+            if (!pastPlane)
+            {
+                kConsider((GetPaddlePlane(kTargetPaddle, ball.radius) - ball.position.x) / kVelocity.x, Event::PaddlePlane);
+            }
+
+            const auto kSideX = kVelocity.x < 0.0f ? ball.radius : skArenaWidth - ball.radius;
+            kConsider((kSideX - ball.position.x) / kVelocity.x, Event::Side);
+        }
+
+        kConsider(nextDecision - elapsed, Event::Decision);
+
+        // Jump to the event.
+        ball.SetPosition(ball.position + kVelocity * time);
+
+        for (auto p = 0u; p < 2u; ++p)
+        {
+            auto& paddle = match.GetPaddle(p);
+            paddle.SetPosition({ paddle.position.x, MovePaddle(paddle.position.y, commands[p].targetY, time) });
+        }
+
+        elapsed += time;
+        ++stats.events;
+
+        switch (event)
+        {
+        case Event::Wall:
+            ball.SetMoveDirection({ ball.moveDirection.x, -ball.moveDirection.y });
+            break;
+
+        case Event::PaddlePlane:
+            if (std::fabs(ball.position.y - kTargetPaddle.position.y) < skPaddleReach)
+            {
+                ball.OnPaddleCollision(kTargetPaddle);
+            }
+            else
+            {
+                pastPlane = true;
+            }
+            break;
+
+        case Event::Side:
+        {
+            const auto kLostSide = kTarget ? Side::Player2 : Side::Player1;
+            ++match.scores[1u - kTarget];
+            match.Reset();
+
+            stats.time += elapsed;
+            return kLostSide;
+        }
+
+        case Event::Decision:
+            nextDecision += settings.decisionInterval;
+            break;
+
+        default: break;
+        }
+
+        Decide(match, settings, commands);
+    }
+
+    stats.time += elapsed;
+    return Side::None;
+}
+
+PaddleCommand InterceptBall(const Match& match, unsigned player, void*) noexcept
+{
+    const auto& kBall = match.ball;
+    const auto& kPaddle = match.GetPaddle(player);
+    const auto& kOpponent = match.GetPaddle(1u - player);
+
+    const auto kVelocity = kBall.moveDirection * kBall.moveSpeed;
+    const auto kIncoming = (kVelocity.x * kPaddle.forward) < 0.0f;
+
+    if (!kIncoming)
+    {
+        // Wait in the middle.
+        return { skArenaHeight / 2.0f };
+    }
+
+    Intercept intercept;
+
+    if (!PredictIntercept(kBall.position, kVelocity, GetPaddlePlane(kPaddle, kBall.radius), kBall.radius,
+        skArenaHeight - kBall.radius, intercept))
+    {
+        return { skArenaHeight / 2.0f };
+    }
+
+    // The ball bounces away from the paddle center, hitting it with the paddle above the ball sends it low.
+    const auto kAimLow = kOpponent.position.y > skArenaHeight / 2.0f;
+    const auto kAimOffset = Match::skPaddleSize.y * 0.3f;
+
+    return { intercept.y + (kAimLow ? kAimOffset : -kAimOffset) };
+}
+
+} // namespace lepong
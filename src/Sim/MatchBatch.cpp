@@ -0,0 +1,379 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstring>
+#include <iterator> // For std::size.
+
+#include "lepong/Check.h"
+#include "lepong/Cpu.h"
+
+#include "MatchBatchKernel.h"
+
+namespace lepong
+{
+
+static_assert(sizeof(PaddleAction) == sizeof(std::uint32_t), "The kernels load actions as 32 bit integers");
+
+MatchBatch::MatchBatch(std::size_t size) noexcept
+    : mSize(size)
+{
+    for (auto* array : { &ballX, &ballY, &ballDirX, &ballDirY, &ballSpeed })
+    {
+        array->resize(size);
+    }
+
+    for (auto p = 0; p < 2; ++p)
+    {
+        paddleY[p].resize(size);
+        paddleDir[p].resize(size);
+        paddleSpeed[p].resize(size);
+        scores[p].resize(size);
+    }
+
+    playing.resize(size);
+    launches.resize(size);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        Restart(i);
+    }
+
+    SetKernel(BatchKernel::Auto);
+}
+
+void MatchBatch::SetKernel(BatchKernel kernel) noexcept
+{
+    mKernel = IsBatchKernelSupported(kernel) && kernel != BatchKernel::Auto ? kernel : GetBestBatchKernel();
+}
+
+void MatchBatch::SetSeed(std::uint64_t seed, std::uint64_t firstStream) noexcept
+{
+    mRandom = Philox4x32(seed, firstStream);
+}
+
+void MatchBatch::SetRules(const MatchRules& rules) noexcept
+{
+    mRules = rules;
+    mDefaultRules = rules.IsDefault();
+}
+
+void MatchBatch::SetSpecialized(bool specialized) noexcept
+{
+    mSpecialized = specialized;
+}
+
+void MatchBatch::Load(std::size_t index, const Match& match) noexcept
+{
+    ballX[index] = match.ball.position.x;
+    ballY[index] = match.ball.position.y;
+    ballDirX[index] = match.ball.moveDirection.x;
+    ballDirY[index] = match.ball.moveDirection.y;
+    ballSpeed[index] = match.ball.moveSpeed;
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        const auto& kPaddle = match.GetPaddle(p);
+
+        paddleY[p][index] = kPaddle.position.y;
+        paddleDir[p][index] = kPaddle.moveDirection.y;
+        paddleSpeed[p][index] = kPaddle.moveSpeed;
+
+        scores[p][index] = match.scores[p];
+    }
+
+    playing[index] = match.playing ? 1u : 0u;
+}
+
+void MatchBatch::Store(std::size_t index, Match& match) const noexcept
+{
+    match.ball.position = { ballX[index], ballY[index] };
+    match.ball.moveDirection = { ballDirX[index], ballDirY[index] };
+    match.ball.moveSpeed = ballSpeed[index];
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        auto& paddle = match.GetPaddle(p);
+
+        paddle.position.y = paddleY[p][index];
+        paddle.moveDirection = { 0.0f, paddleDir[p][index] };
+        paddle.moveSpeed = paddleSpeed[p][index];
+
+        match.scores[p] = scores[p][index];
+    }
+
+    match.playing = playing[index] != 0u;
+    match.Rehash();
+}
+
+void MatchBatch::Restart(std::size_t index) noexcept
+{
+    Load(index, Match{});
+
+    // Ball::Reset and Paddle::Reset with the arena of the rules.
+    ballX[index] = mRules.arenaSize.x / 2.0f;
+    ballY[index] = mRules.arenaSize.y / 2.0f;
+
+    paddleY[0][index] = mRules.arenaSize.y / 2.0f;
+    paddleY[1][index] = mRules.arenaSize.y / 2.0f;
+}
+
+void MatchBatch::Launch(std::size_t index) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(!playing[index]);
+
+    playing[index] = 1u;
+
+    const auto kBlock = Philox4x32::Generate(launches[index]++, mRandom.stream + index, mRandom.key);
+
+    const auto kSignX = (kBlock.values[0] >> 31u) ? 1.0f : -1.0f;
+    const auto kSignY = (kBlock.values[1] >> 31u) ? 1.0f : -1.0f;
+
+    // Same operations as Match::Launch.
+    const Vector2f kDirection = Normalize({ kSignX, kSignY });
+
+    ballSpeed[index] = mRules.ballSpeed;
+    ballDirX[index] = kDirection.x;
+    ballDirY[index] = kDirection.y;
+}
+
+void MatchBatch::LaunchWaiting() noexcept
+{
+    for (std::size_t i = 0; i < mSize; ++i)
+    {
+        if (!playing[i])
+        {
+            Launch(i);
+        }
+    }
+}
+
+///
+/// Steps every lane with the kernel, the lanes that don't fill a whole register with the scalar kernel.
+///
+template<typename Rules>
+static void StepKernel(BatchKernel kernel, const BatchKernels::Lanes& lanes, const Rules& rules, std::size_t size, float delta) noexcept
+{
+    std::size_t width = 1;
+
+    switch (kernel)
+    {
+    case BatchKernel::SSE2:
+        width = 4;
+        break;
+
+    case BatchKernel::AVX2:
+        width = 8;
+        break;
+
+    default: break;
+    }
+
+    // The scalar kernel steps the lanes that don't fill a whole register, or all of them.
+    const auto kVectorEnd = width > 1 ? size - (size % width) : 0;
+
+#if defined(LEPONG_X86_KERNELS)
+    switch (kernel)
+    {
+    case BatchKernel::SSE2:
+        BatchKernels::StepSSE2(lanes, rules, 0, kVectorEnd, delta);
+        break;
+
+    case BatchKernel::AVX2:
+        BatchKernels::StepAVX2(lanes, rules, 0, kVectorEnd, delta);
+        break;
+
+    default: break;
+    }
+#endif
+
+    BatchKernels::StepScalar(lanes, rules, kVectorEnd, size, delta);
+}
+
+void MatchBatch::Step(float delta, const PaddleAction* actions) noexcept
+{
+    if (mKernel == BatchKernel::Reference)
+    {
+        BatchKernels::StepReference(*this, 0, mSize, delta, actions);
+        return;
+    }
+
+    const auto kLanes = BatchKernels::GetLanes(*this, actions);
+
+    if (mDefaultRules && mSpecialized)
+    {
+        StepKernel(mKernel, kLanes, GameRules{}, mSize, delta);
+    }
+    else
+    {
+        StepKernel(mKernel, kLanes, BatchKernels::GetRuleValues(RuntimeRules(mRules)), mSize, delta);
+    }
+}
+
+bool IsBatchKernelSupported(BatchKernel kernel) noexcept
+{
+    switch (kernel)
+    {
+    case BatchKernel::SSE2:
+        return Cpu::HasSSE2();
+
+    case BatchKernel::AVX2:
+        return Cpu::HasAVX2();
+
+    default:
+        return true;
+    }
+}
+
+BatchKernel GetBestBatchKernel() noexcept
+{
+    static const auto skBest =
+        IsBatchKernelSupported(BatchKernel::AVX2) ? BatchKernel::AVX2 :
+        IsBatchKernelSupported(BatchKernel::SSE2) ? BatchKernel::SSE2 :
+        BatchKernel::Scalar;
+
+    return skBest;
+}
+
+static constexpr const char* skKernelNames[] = { "auto", "reference", "scalar", "sse2", "avx2" };
+
+const char* GetBatchKernelName(BatchKernel kernel) noexcept
+{
+    return skKernelNames[static_cast<int>(kernel)];
+}
+
+bool ParseBatchKernel(const char* name, BatchKernel& kernel) noexcept
+{
+    for (auto i = 0u; i < std::size(skKernelNames); ++i)
+    {
+        if (!std::strcmp(name, skKernelNames[i]))
+        {
+            kernel = static_cast<BatchKernel>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FillTrackBallActions(const MatchBatch& batch, PaddleAction* actions, float deadZone) noexcept
+{
+    const auto kSize = batch.Size();
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        auto* playerActions = actions + p * kSize;
+
+        // Same logic as TrackBall, written so that the compiler can vectorize it.
+        for (std::size_t i = 0; i < kSize; ++i)
+        {
+            const auto kOffset = batch.ballY[i] - batch.paddleY[p][i];
+
+            const auto kUp = kOffset > deadZone ? 1 : 0;
+            const auto kDown = kOffset < -deadZone ? 2 : 0;
+
+            playerActions[i] = static_cast<PaddleAction>(kUp | kDown);
+        }
+    }
+}
+
+namespace BatchKernels
+{
+
+Lanes GetLanes(MatchBatch& batch, const PaddleAction* actions) noexcept
+{
+    Lanes lanes = {};
+
+    lanes.ballX = batch.ballX.data();
+    lanes.ballY = batch.ballY.data();
+    lanes.ballDirX = batch.ballDirX.data();
+    lanes.ballDirY = batch.ballDirY.data();
+    lanes.ballSpeed = batch.ballSpeed.data();
+
+    for (auto p = 0; p < 2; ++p)
+    {
+        lanes.paddleY[p] = batch.paddleY[p].data();
+        lanes.paddleDir[p] = batch.paddleDir[p].data();
+        lanes.paddleSpeed[p] = batch.paddleSpeed[p].data();
+        lanes.scores[p] = batch.scores[p].data();
+        lanes.actions[p] = actions + p * batch.Size();
+    }
+
+    lanes.playing = batch.playing.data();
+
+    return lanes;
+}
+
+void StepReference(MatchBatch& batch, std::size_t begin, std::size_t end, float delta, const PaddleAction* actions) noexcept
+{
+    Match match;
+
+    for (auto i = begin; i < end; ++i)
+    {
+        batch.Store(i, match);
+
+        match.paddle1.ApplyAction(actions[i]);
+        match.paddle2.ApplyAction(actions[batch.Size() + i]);
+        match.Update(delta);
+
+        batch.Load(i, match);
+    }
+}
+
+///
+/// One lane at a time, masks are plain bools.
+///
+struct ScalarOps
+{
+    static constexpr std::size_t skWidth = 1;
+
+    using F = float;
+    using M = bool;
+    using U = std::uint32_t;
+
+    static F Load(const float* p) noexcept { return *p; }
+    static void Store(float* p, F v) noexcept { *p = v; }
+    static F Set(float s) noexcept { return s; }
+
+    static F Add(F a, F b) noexcept { return a + b; }
+    static F Sub(F a, F b) noexcept { return a - b; }
+    static F Mul(F a, F b) noexcept { return a * b; }
+    static F Div(F a, F b) noexcept { return a / b; }
+    static F Sqrt(F a) noexcept { return sqrtf(a); }
+    static F Neg(F a) noexcept { return -a; }
+
+    static M Lt(F a, F b) noexcept { return a < b; }
+    static M Gt(F a, F b) noexcept { return a > b; }
+    static M Ne(F a, F b) noexcept { return a != b; }
+
+    static M False() noexcept { return false; }
+    static M And(M a, M b) noexcept { return a & b; }
+    static M Or(M a, M b) noexcept { return a | b; }
+    static M AndNot(M a, M b) noexcept { return a & !b; }
+    static bool Any(M m) noexcept { return m; }
+
+    static F Select(M m, F a, F b) noexcept { return m ? a : b; }
+
+    static M ActionIs(const PaddleAction* p, PaddleAction action) noexcept { return *p == action; }
+
+    static U LoadU(const std::uint32_t* p) noexcept { return *p; }
+    static void StoreU(std::uint32_t* p, U v) noexcept { *p = v; }
+    static U SetU(std::uint32_t s) noexcept { return s; }
+    static U SelectU(M m, U a, U b) noexcept { return m ? a : b; }
+
+    static U Increment(U u, M m) noexcept { return u + (m ? 1u : 0u); }
+};
+
+void StepScalar(const Lanes& lanes, const GameRules&, std::size_t begin, std::size_t end, float delta) noexcept
+{
+    StepLanes<ScalarOps, true>(lanes, skGameRuleValues, begin, end, delta);
+}
+
+void StepScalar(const Lanes& lanes, const RuleValues& rules, std::size_t begin, std::size_t end, float delta) noexcept
+{
+    StepLanes<ScalarOps, false>(lanes, rules, begin, end, delta);
+}
+
+} // namespace BatchKernels
+
+} // namespace lepong
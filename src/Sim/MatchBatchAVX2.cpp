@@ -0,0 +1,82 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <immintrin.h>
+
+#include "MatchBatchKernel.h"
+
+namespace lepong::BatchKernels
+{
+
+// The operations are only ever compiled for this instruction set, keeping them internal ensures the linker never
+// picks them for code that may run on a CPU without it.
+namespace
+{
+
+///
+/// Eight lanes per register, masks are all ones or all zeros.
+///
+struct AVX2Ops
+{
+    static constexpr std::size_t skWidth = 8;
+
+    using F = __m256;
+    using M = __m256;
+    using U = __m256i;
+
+    static F Load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static void Store(float* p, F v) noexcept { _mm256_storeu_ps(p, v); }
+    static F Set(float s) noexcept { return _mm256_set1_ps(s); }
+
+    static F Add(F a, F b) noexcept { return _mm256_add_ps(a, b); }
+    static F Sub(F a, F b) noexcept { return _mm256_sub_ps(a, b); }
+    static F Mul(F a, F b) noexcept { return _mm256_mul_ps(a, b); }
+    static F Div(F a, F b) noexcept { return _mm256_div_ps(a, b); }
+    static F Sqrt(F a) noexcept { return _mm256_sqrt_ps(a); }
+    static F Neg(F a) noexcept { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+
+    static M Lt(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static M Gt(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static M Ne(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+
+    static M False() noexcept { return _mm256_setzero_ps(); }
+    static M And(M a, M b) noexcept { return _mm256_and_ps(a, b); }
+    static M Or(M a, M b) noexcept { return _mm256_or_ps(a, b); }
+    static bool Any(M m) noexcept { return _mm256_movemask_ps(m) != 0; }
+    static M AndNot(M a, M b) noexcept { return _mm256_andnot_ps(b, a); }
+
+    static F Select(M m, F a, F b) noexcept { return _mm256_blendv_ps(b, a, m); }
+
+    static M ActionIs(const PaddleAction* p, PaddleAction action) noexcept
+    {
+        const auto kActions = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        return _mm256_castsi256_ps(_mm256_cmpeq_epi32(kActions, _mm256_set1_epi32(static_cast<int>(action))));
+    }
+
+    static U LoadU(const std::uint32_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void StoreU(std::uint32_t* p, U v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static U SetU(std::uint32_t s) noexcept { return _mm256_set1_epi32(static_cast<int>(s)); }
+
+    static U SelectU(M m, U a, U b) noexcept
+    {
+        return _mm256_blendv_epi8(b, a, _mm256_castps_si256(m));
+    }
+
+    // A set mask is -1, subtracting it adds one.
+    static U Increment(U u, M m) noexcept { return _mm256_sub_epi32(u, _mm256_castps_si256(m)); }
+};
+
+} // namespace
+
+void StepAVX2(const Lanes& lanes, const GameRules&, std::size_t begin, std::size_t end, float delta) noexcept
+{
+    StepLanes<AVX2Ops, true>(lanes, skGameRuleValues, begin, end, delta);
+}
+
+void StepAVX2(const Lanes& lanes, const RuleValues& rules, std::size_t begin, std::size_t end, float delta) noexcept
+{
+    StepLanes<AVX2Ops, false>(lanes, rules, begin, end, delta);
+}
+
+} // namespace lepong::BatchKernels
@@ -0,0 +1,266 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "lepong/Sim/MatchBatch.h"
+
+// The batch step written once against a small set of lane operations. Each kernel translation unit provides its
+// own operations and instantiates StepLanes with them.
+//
+// Every operation below mirrors one operation of the scalar code in Ball.cpp, Paddle.cpp and Match.cpp, in the same
+// order and with the same constants, which is what keeps the kernels bit-for-bit equal to the reference. Kernel
+// translation units must be compiled without floating point contraction.
+
+namespace lepong::BatchKernels
+{
+
+///
+/// Raw pointers to the batch arrays, offset to the first lane to step.
+///
+struct Lanes
+{
+    float* ballX;
+    float* ballY;
+    float* ballDirX;
+    float* ballDirY;
+    float* ballSpeed;
+
+    float* paddleY[2];
+    float* paddleDir[2];
+    float* paddleSpeed[2];
+
+    std::uint32_t* scores[2];
+    std::uint32_t* playing;
+
+    const PaddleAction* actions[2];
+};
+
+LEPONG_NODISCARD Lanes GetLanes(MatchBatch& batch, const PaddleAction* actions) noexcept;
+
+///
+/// Steps lanes [begin, end) of the batch one match at a time.
+///
+void StepReference(MatchBatch& batch, std::size_t begin, std::size_t end, float delta, const PaddleAction* actions) noexcept;
+
+///
+/// The rule values the kernels read. Kernels only ever see these, never the rule policies: called from a kernel
+/// translation unit, the inline functions of the policies would be compiled with its instruction set, and the linker
+/// could keep that version for code that may run on a CPU without it.
+///
+struct RuleValues
+{
+    float arenaWidth;
+    float arenaHeight;
+    float ballRadius;
+    float paddleSpeed;
+    float hitSpeedGain;
+    float paddleHalfWidth;
+    float paddleHalfHeight;
+    float paddleMinTerrainOffset;
+    float paddleTopLimit;
+    float paddleGraceZone;
+    float paddleX[2];
+};
+
+///
+/// Reads the values of a rule policy. Only call it outside of the kernel translation units, or in constant expressions.
+///
+template<typename Rules>
+LEPONG_NODISCARD constexpr RuleValues GetRuleValues(const Rules& rules) noexcept
+{
+    return {
+        rules.GetArenaWidth(),
+        rules.GetArenaHeight(),
+        rules.GetBallRadius(),
+        rules.GetPaddleSpeed(),
+        rules.GetHitSpeedGain(),
+        rules.GetPaddleHalfWidth(),
+        rules.GetPaddleHalfHeight(),
+        rules.GetPaddleMinTerrainOffset(),
+        rules.GetPaddleTopLimit(),
+        rules.GetPaddleGraceZone(),
+        { rules.GetPaddleX(0), rules.GetPaddleX(1) }
+    };
+}
+
+// Computed by the compiler, so the kernels never call the functions of GameRules.
+static constexpr auto skGameRuleValues = GetRuleValues(GameRules{});
+
+// The GameRules overloads have every value of the rules folded in, the others read them from the values given.
+
+void StepScalar(const Lanes& lanes, const GameRules& rules, std::size_t begin, std::size_t end, float delta) noexcept;
+void StepScalar(const Lanes& lanes, const RuleValues& rules, std::size_t begin, std::size_t end, float delta) noexcept;
+void StepSSE2(const Lanes& lanes, const GameRules& rules, std::size_t begin, std::size_t end, float delta) noexcept;
+void StepSSE2(const Lanes& lanes, const RuleValues& rules, std::size_t begin, std::size_t end, float delta) noexcept;
+void StepAVX2(const Lanes& lanes, const GameRules& rules, std::size_t begin, std::size_t end, float delta) noexcept;
+void StepAVX2(const Lanes& lanes, const RuleValues& rules, std::size_t begin, std::size_t end, float delta) noexcept;
+
+static constexpr float skPaddleForward[2] = { 1.0f, -1.0f };
+
+///
+/// Steps lanes [begin, end) where <i>end - begin</i> is a multiple of <code>Ops::skWidth</code>.
+///
+/// \tparam Fixed Whether to step with <i>skGameRuleValues</i>, which the compiler folds into the code, instead of
+/// <i>values</i>.
+///
+template<typename Ops, bool Fixed>
+void StepLanes(const Lanes& lanes, const RuleValues& values, std::size_t begin, std::size_t end, float delta) noexcept
+{
+    using F = typename Ops::F;
+    using U = typename Ops::U;
+
+    const auto& rules = Fixed ? skGameRuleValues : values;
+
+    const auto kDelta = Ops::Set(delta);
+    const auto kZero = Ops::Set(0.0f);
+
+    const auto kArenaWidth = rules.arenaWidth;
+    const auto kArenaHeight = rules.arenaHeight;
+    const auto kRadius = rules.ballRadius;
+    const auto kPaddleHalfWidth = rules.paddleHalfWidth;
+
+    const auto kPaddleSpeed = Ops::Set(rules.paddleSpeed);
+    const auto kHitSpeedGain = Ops::Set(rules.hitSpeedGain);
+    const auto kPaddleHalfHeight = Ops::Set(rules.paddleHalfHeight);
+    const auto kPaddleMinTerrainOffset = Ops::Set(rules.paddleMinTerrainOffset);
+    const auto kPaddleTopLimit = Ops::Set(rules.paddleTopLimit);
+    const auto kPaddleGraceZone = Ops::Set(rules.paddleGraceZone);
+
+    for (auto i = begin; i < end; i += Ops::skWidth)
+    {
+        auto ballX = Ops::Load(lanes.ballX + i);
+        auto ballY = Ops::Load(lanes.ballY + i);
+        auto dirX = Ops::Load(lanes.ballDirX + i);
+        auto dirY = Ops::Load(lanes.ballDirY + i);
+        auto speed = Ops::Load(lanes.ballSpeed + i);
+
+        F paddleY[2];
+        F paddleDir[2];
+        F paddleSpeed[2];
+
+        // Paddle::ApplyAction then Paddle::Update.
+        for (auto p = 0; p < 2; ++p)
+        {
+            paddleY[p] = Ops::Load(lanes.paddleY[p] + i);
+            paddleDir[p] = Ops::Load(lanes.paddleDir[p] + i);
+            paddleSpeed[p] = Ops::Load(lanes.paddleSpeed[p] + i);
+
+            const auto kUp = Ops::ActionIs(lanes.actions[p] + i, PaddleAction::Up);
+            const auto kDown = Ops::ActionIs(lanes.actions[p] + i, PaddleAction::Down);
+            const auto kStay = Ops::ActionIs(lanes.actions[p] + i, PaddleAction::Stay);
+
+            // Releasing only stops a paddle that is moving.
+            const auto kStop = Ops::And(kStay, Ops::Ne(paddleDir[p], kZero));
+            const auto kPressed = Ops::Or(kUp, kDown);
+
+            paddleSpeed[p] = Ops::Select(kStop, kZero, paddleSpeed[p]);
+            paddleSpeed[p] = Ops::Select(kPressed, kPaddleSpeed, paddleSpeed[p]);
+
+            paddleDir[p] = Ops::Select(kStop, kZero, paddleDir[p]);
+            paddleDir[p] = Ops::Select(kUp, Ops::Set(1.0f), paddleDir[p]);
+            paddleDir[p] = Ops::Select(kDown, Ops::Set(-1.0f), paddleDir[p]);
+        }
+
+        // GameObject::Update for the ball.
+        ballX = Ops::Add(ballX, Ops::Mul(Ops::Mul(dirX, speed), kDelta));
+        ballY = Ops::Add(ballY, Ops::Mul(Ops::Mul(dirY, speed), kDelta));
+
+        // Paddle::Update, the x position doesn't move since the paddles only move vertically.
+        for (auto p = 0; p < 2; ++p)
+        {
+            const auto kPreUpdateY = paddleY[p];
+            paddleY[p] = Ops::Add(paddleY[p], Ops::Mul(Ops::Mul(paddleDir[p], paddleSpeed[p]), kDelta));
+
+            const auto kCollidesTop = Ops::Gt(Ops::Add(paddleY[p], kPaddleMinTerrainOffset), kPaddleTopLimit);
+            const auto kCollidesBottom = Ops::Lt(Ops::Sub(paddleY[p], kPaddleMinTerrainOffset), kPaddleHalfHeight);
+
+            paddleY[p] = Ops::Select(Ops::Or(kCollidesTop, kCollidesBottom), kPreUpdateY, paddleY[p]);
+        }
+
+        // Ball::CollideWithTerrain.
+        {
+            const auto kCollidesTop = Ops::And(Ops::Gt(ballY, Ops::Set(kArenaHeight - kRadius)), Ops::Gt(dirY, kZero));
+            const auto kCollidesBottom = Ops::And(Ops::Lt(ballY, Ops::Set(kRadius)), Ops::Lt(dirY, kZero));
+
+            dirY = Ops::Select(Ops::Or(kCollidesTop, kCollidesBottom), Ops::Neg(dirY), dirY);
+        }
+
+        // Ball::CollideWith, the second paddle is only checked if the first one didn't collide.
+        auto collides = Ops::False();
+
+        for (auto p = 0; p < 2; ++p)
+        {
+            const auto kForward = skPaddleForward[p];
+
+            const auto kMovingToward = Ops::Lt(Ops::Mul(dirX, Ops::Set(kForward)), kZero);
+
+            const auto kOuterEdge = Ops::Add(ballX, Ops::Set((kRadius * 0.25f) * -kForward));
+            const auto kFrontEdge = Ops::Set(rules.paddleX[p] + kPaddleHalfWidth * kForward);
+
+            const auto kBehind = kForward > 0.0f ? Ops::Lt(kOuterEdge, kFrontEdge) : Ops::Gt(kOuterEdge, kFrontEdge);
+
+            const auto kInRangeY = Ops::And(
+                Ops::Lt(ballY, Ops::Add(Ops::Add(paddleY[p], kPaddleHalfHeight), kPaddleGraceZone)),
+                Ops::Gt(ballY, Ops::Sub(Ops::Sub(paddleY[p], kPaddleHalfHeight), kPaddleGraceZone)));
+
+            const auto kToFrontX = Ops::Sub(ballX, kFrontEdge);
+            const auto kTouching = Ops::Lt(Ops::Mul(kToFrontX, kToFrontX), Ops::Set(kRadius * kRadius));
+
+            auto hit = Ops::And(Ops::AndNot(kMovingToward, kBehind), Ops::And(kInRangeY, kTouching));
+            hit = Ops::AndNot(hit, collides);
+
+            // Ball::OnPaddleCollision. Hits are rare so the square root and divisions are skipped when no lane hits.
+            if (Ops::Any(hit))
+            {
+                const auto kAwayX = Ops::Sub(ballX, Ops::Set(rules.paddleX[p]));
+                const auto kAwayY = Ops::Sub(ballY, paddleY[p]);
+                const auto kMag = Ops::Sqrt(Ops::Add(Ops::Mul(kAwayX, kAwayX), Ops::Mul(kAwayY, kAwayY)));
+
+                speed = Ops::Select(hit, Ops::Add(speed, kHitSpeedGain), speed);
+                dirX = Ops::Select(hit, Ops::Div(kAwayX, kMag), dirX);
+                dirY = Ops::Select(hit, Ops::Div(kAwayY, kMag), dirY);
+
+                collides = Ops::Or(collides, hit);
+            }
+        }
+
+        // Ball::GetTouchingSide then the score update and reset from Match.
+        const auto kTouchesLeft = Ops::Lt(ballX, Ops::Set(kRadius));
+        const auto kTouchesRight = Ops::Gt(ballX, Ops::Set(kArenaWidth - kRadius));
+
+        const auto kPlayer1Lost = Ops::AndNot(kTouchesLeft, collides);
+        const auto kPlayer2Lost = Ops::AndNot(Ops::AndNot(kTouchesRight, kTouchesLeft), collides);
+        const auto kReset = Ops::Or(kPlayer1Lost, kPlayer2Lost);
+
+        U scores[2] = { Ops::LoadU(lanes.scores[0] + i), Ops::LoadU(lanes.scores[1] + i) };
+        scores[0] = Ops::Increment(scores[0], kPlayer2Lost);
+        scores[1] = Ops::Increment(scores[1], kPlayer1Lost);
+
+        Ops::StoreU(lanes.scores[0] + i, scores[0]);
+        Ops::StoreU(lanes.scores[1] + i, scores[1]);
+        Ops::StoreU(lanes.playing + i, Ops::SelectU(kReset, Ops::SetU(0u), Ops::LoadU(lanes.playing + i)));
+
+        // Ball::Reset and Paddle::Reset.
+        const auto kCenterX = Ops::Set(kArenaWidth / 2.0f);
+        const auto kCenterY = Ops::Set(kArenaHeight / 2.0f);
+
+        Ops::Store(lanes.ballX + i, Ops::Select(kReset, kCenterX, ballX));
+        Ops::Store(lanes.ballY + i, Ops::Select(kReset, kCenterY, ballY));
+        Ops::Store(lanes.ballDirX + i, Ops::Select(kReset, kZero, dirX));
+        Ops::Store(lanes.ballDirY + i, Ops::Select(kReset, kZero, dirY));
+        Ops::Store(lanes.ballSpeed + i, Ops::Select(kReset, kZero, speed));
+
+        for (auto p = 0; p < 2; ++p)
+        {
+            Ops::Store(lanes.paddleY[p] + i, Ops::Select(kReset, kCenterY, paddleY[p]));
+            Ops::Store(lanes.paddleDir[p] + i, Ops::Select(kReset, kZero, paddleDir[p]));
+            Ops::Store(lanes.paddleSpeed[p] + i, Ops::Select(kReset, kZero, paddleSpeed[p]));
+        }
+    }
+}
+
+} // namespace lepong::BatchKernels
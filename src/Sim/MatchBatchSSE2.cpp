@@ -0,0 +1,83 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <emmintrin.h>
+
+#include "MatchBatchKernel.h"
+
+namespace lepong::BatchKernels
+{
+
+// The operations are only ever compiled for this instruction set, keeping them internal ensures the linker never
+// picks them for code that may run on a CPU without it.
+namespace
+{
+
+///
+/// Four lanes per register, masks are all ones or all zeros.
+///
+struct SSE2Ops
+{
+    static constexpr std::size_t skWidth = 4;
+
+    using F = __m128;
+    using M = __m128;
+    using U = __m128i;
+
+    static F Load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static void Store(float* p, F v) noexcept { _mm_storeu_ps(p, v); }
+    static F Set(float s) noexcept { return _mm_set1_ps(s); }
+
+    static F Add(F a, F b) noexcept { return _mm_add_ps(a, b); }
+    static F Sub(F a, F b) noexcept { return _mm_sub_ps(a, b); }
+    static F Mul(F a, F b) noexcept { return _mm_mul_ps(a, b); }
+    static F Div(F a, F b) noexcept { return _mm_div_ps(a, b); }
+    static F Sqrt(F a) noexcept { return _mm_sqrt_ps(a); }
+    static F Neg(F a) noexcept { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+
+    static M Lt(F a, F b) noexcept { return _mm_cmplt_ps(a, b); }
+    static M Gt(F a, F b) noexcept { return _mm_cmpgt_ps(a, b); }
+    static M Ne(F a, F b) noexcept { return _mm_cmpneq_ps(a, b); }
+
+    static M False() noexcept { return _mm_setzero_ps(); }
+    static M And(M a, M b) noexcept { return _mm_and_ps(a, b); }
+    static M Or(M a, M b) noexcept { return _mm_or_ps(a, b); }
+    static bool Any(M m) noexcept { return _mm_movemask_ps(m) != 0; }
+    static M AndNot(M a, M b) noexcept { return _mm_andnot_ps(b, a); }
+
+    static F Select(M m, F a, F b) noexcept { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+    static M ActionIs(const PaddleAction* p, PaddleAction action) noexcept
+    {
+        const auto kActions = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(kActions, _mm_set1_epi32(static_cast<int>(action))));
+    }
+
+    static U LoadU(const std::uint32_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void StoreU(std::uint32_t* p, U v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static U SetU(std::uint32_t s) noexcept { return _mm_set1_epi32(static_cast<int>(s)); }
+
+    static U SelectU(M m, U a, U b) noexcept
+    {
+        const auto kMask = _mm_castps_si128(m);
+        return _mm_or_si128(_mm_and_si128(kMask, a), _mm_andnot_si128(kMask, b));
+    }
+
+    // A set mask is -1, subtracting it adds one.
+    static U Increment(U u, M m) noexcept { return _mm_sub_epi32(u, _mm_castps_si128(m)); }
+};
+
+} // namespace
+
+void StepSSE2(const Lanes& lanes, const GameRules&, std::size_t begin, std::size_t end, float delta) noexcept
+{
+    StepLanes<SSE2Ops, true>(lanes, skGameRuleValues, begin, end, delta);
+}
+
+void StepSSE2(const Lanes& lanes, const RuleValues& rules, std::size_t begin, std::size_t end, float delta) noexcept
+{
+    StepLanes<SSE2Ops, false>(lanes, rules, begin, end, delta);
+}
+
+} // namespace lepong::BatchKernels
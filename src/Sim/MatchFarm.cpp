@@ -0,0 +1,303 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#if defined(_WIN32)
+#include <Windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <atomic>
+
+#include "lepong/Check.h"
+#include "lepong/Game/Bot.h"
+#include "lepong/Sim/MatchFarm.h"
+
+namespace lepong
+{
+
+// Keeps the workers from sharing cache lines. Not std::hardware_destructive_interference_size, which not every
+// supported compiler has.
+static constexpr std::size_t skCacheLineSize = 64;
+
+///
+/// What a thread owns. The range is the only thing other threads touch, when stealing.
+///
+struct alignas(skCacheLineSize) MatchFarm::Worker
+{
+    // The matches [begin, end) left to this thread, begin in the high 32 bits.
+    std::atomic<std::uint64_t> range{ 0 };
+
+    unsigned long long steals = 0;
+};
+
+LEPONG_NODISCARD static constexpr std::uint64_t PackRange(std::uint64_t begin, std::uint64_t end) noexcept
+{
+    return (begin << 32u) | end;
+}
+
+LEPONG_NODISCARD static constexpr std::uint64_t GetRangeBegin(std::uint64_t range) noexcept
+{
+    return range >> 32u;
+}
+
+LEPONG_NODISCARD static constexpr std::uint64_t GetRangeEnd(std::uint64_t range) noexcept
+{
+    return range & 0xFFFFFFFFull;
+}
+
+///
+/// Pins the calling thread to a CPU, does nothing on other platforms.
+///
+static void PinThread(unsigned cpu) noexcept
+{
+#if defined(_WIN32)
+    const auto kMask = static_cast<DWORD_PTR>(1) << (cpu % (sizeof(DWORD_PTR) * 8u));
+    SetThreadAffinityMask(GetCurrentThread(), kMask);
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+MatchFarm::MatchFarm(const MatchFarmSettings& settings) noexcept
+    : mSettings(settings)
+{
+    static_assert(sizeof(Worker) % skCacheLineSize == 0, "Workers must not share cache lines");
+
+    auto threads = settings.threads ? settings.threads : std::thread::hardware_concurrency();
+    threads = threads ? threads : 1u;
+
+    mWorkers = std::make_unique<Worker[]>(threads);
+    mThreads.reserve(threads);
+
+    for (auto i = 0u; i < threads; ++i)
+    {
+        mThreads.emplace_back(&MatchFarm::WorkerMain, this, i);
+    }
+}
+
+MatchFarm::~MatchFarm() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+
+    mStart.notify_all();
+
+    for (auto& thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+void MatchFarm::Run(std::size_t count, PFNPlayMatch play, void* userData, MatchResult* results) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(count <= 0xFFFFFFFFull);
+
+    const auto kThreads = static_cast<std::uint64_t>(mThreads.size());
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (std::uint64_t i = 0; i < kThreads; ++i)
+        {
+            auto& worker = mWorkers[i];
+
+            worker.range.store(PackRange(count * i / kThreads, count * (i + 1) / kThreads), std::memory_order_relaxed);
+            worker.steals = 0;
+        }
+
+        mPlay = play;
+        mUserData = userData;
+        mResults = results;
+
+        mRunning = static_cast<unsigned>(kThreads);
+        ++mGeneration;
+    }
+
+    mStart.notify_all();
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDone.wait(lock, [this] { return mRunning == 0; });
+}
+
+unsigned long long MatchFarm::GetSteals() const noexcept
+{
+    unsigned long long steals = 0;
+
+    for (std::size_t i = 0; i < mThreads.size(); ++i)
+    {
+        steals += mWorkers[i].steals;
+    }
+
+    return steals;
+}
+
+void MatchFarm::WorkerMain(unsigned index) noexcept
+{
+    if (mSettings.pinThreads)
+    {
+        PinThread(index);
+    }
+
+    unsigned long long generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStart.wait(lock, [&] { return mStopping || mGeneration != generation; });
+
+            LEPONG_CHECK_OR_RETURN(!mStopping);
+            generation = mGeneration;
+        }
+
+        Work(index);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (--mRunning == 0)
+        {
+            mDone.notify_one();
+        }
+    }
+}
+
+void MatchFarm::Work(unsigned index) noexcept
+{
+    std::size_t match = 0;
+
+    while (PopMatch(index, match) || (Steal(index) && PopMatch(index, match)))
+    {
+        Match instance;
+        instance.random = Random(mSettings.seed, match);
+
+        mResults[match] = {};
+        mPlay(instance, match, mResults[match], mUserData);
+    }
+}
+
+bool MatchFarm::PopMatch(unsigned index, std::size_t& match) noexcept
+{
+    auto& range = mWorkers[index].range;
+    auto current = range.load(std::memory_order_acquire);
+
+    // The owner takes from the front, thieves take from the back.
+    while (GetRangeBegin(current) < GetRangeEnd(current))
+    {
+        const auto kBegin = GetRangeBegin(current);
+
+        if (range.compare_exchange_weak(current, PackRange(kBegin + 1, GetRangeEnd(current)), std::memory_order_acq_rel))
+        {
+            match = static_cast<std::size_t>(kBegin);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool MatchFarm::Steal(unsigned index) noexcept
+{
+    const auto kThreads = static_cast<unsigned>(mThreads.size());
+
+    while (true)
+    {
+        // The victim with the most matches left, so that steals are rare.
+        auto victim = kThreads;
+        std::uint64_t victimRange = 0;
+        std::uint64_t mostLeft = 0;
+
+        for (auto i = 1u; i < kThreads; ++i)
+        {
+            const auto kCandidate = (index + i) % kThreads;
+            const auto kRange = mWorkers[kCandidate].range.load(std::memory_order_acquire);
+            const auto kLeft = GetRangeEnd(kRange) - GetRangeBegin(kRange);
+
+            if (GetRangeBegin(kRange) < GetRangeEnd(kRange) && kLeft > mostLeft)
+            {
+                victim = kCandidate;
+                victimRange = kRange;
+                mostLeft = kLeft;
+            }
+        }
+
+        LEPONG_CHECK_OR_RETURN_VAL(victim != kThreads, false);
+
+        // Take the back half, rounded up so that a single match can be stolen too.
+        const auto kBegin = GetRangeBegin(victimRange);
+        const auto kEnd = GetRangeEnd(victimRange);
+        const auto kMiddle = kBegin + (kEnd - kBegin) / 2u;
+
+        if (mWorkers[victim].range.compare_exchange_strong(victimRange, PackRange(kBegin, kMiddle), std::memory_order_acq_rel))
+        {
+            auto& worker = mWorkers[index];
+
+            worker.range.store(PackRange(kMiddle, kEnd), std::memory_order_release);
+            ++worker.steals;
+
+            return true;
+        }
+    }
+}
+
+void PlayBotMatch(Match& match, std::size_t index, MatchResult& result, void* userData) noexcept
+{
+    const auto& kSettings = *static_cast<const BotMatchSettings*>(userData);
+
+    match.continuousCollision = kSettings.continuousCollision;
+
+    ReplayRecorder recorder;
+    const auto kRecording = kSettings.replays != nullptr;
+
+    if (kRecording)
+    {
+        // Both players are bots, only the launches end up in the replay.
+        recorder.Begin(match, kSettings.delta, kSettings.replays[index], 3u);
+    }
+
+    while (match.scores[0] < kSettings.points && match.scores[1] < kSettings.points && result.ticks < kSettings.maxTicks)
+    {
+        if (!match.playing)
+        {
+            match.Launch();
+
+            if (kRecording)
+            {
+                recorder.Launch();
+            }
+        }
+
+        const PaddleAction kActions[] = { TrackBall(match.paddle1, match.ball), TrackBall(match.paddle2, match.ball) };
+
+        match.paddle1.ApplyAction(kActions[0]);
+        match.paddle2.ApplyAction(kActions[1]);
+
+        if (kRecording)
+        {
+            recorder.Tick(kActions);
+        }
+
+        match.Update(kSettings.delta);
+        ++result.ticks;
+    }
+
+    if (kRecording)
+    {
+        recorder.End(match);
+    }
+
+    result.scores[0] = match.scores[0];
+    result.scores[1] = match.scores[1];
+}
+
+} // namespace lepong
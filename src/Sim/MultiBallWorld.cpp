@@ -0,0 +1,415 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+
+#include "lepong/Check.h"
+#include "lepong/Sim/MultiBallWorld.h"
+
+#include "WorkerGroup.h"
+
+namespace lepong
+{
+
+// The paddles use the sizes and the movement rules of a match.
+static constexpr auto skPaddleHalfWidth = Match::skPaddleSize.x / 2.0f;
+static constexpr auto skPaddleHalfHeight = Match::skPaddleSize.y / 2.0f;
+static constexpr auto skPaddleMinTerrainOffset = Match::skPaddleSize.y * 0.1f;
+
+static constexpr float skPaddleForward[2] = { 1.0f, -1.0f };
+
+MultiBallWorld::MultiBallWorld(const MultiBallSettings& settings) noexcept
+    : mSettings(settings)
+    , mRandom(settings.seed)
+    , mCellSize(settings.ballRadius * 2.0f)
+{
+    // An empty column on each side and an empty row at the bottom, so that every cell has all the neighbours
+    // CollideBalls looks at.
+    mGridWidth = static_cast<std::uint32_t>(std::ceil(static_cast<float>(settings.arenaSize.x) / mCellSize)) + 2u;
+    mGridHeight = static_cast<std::uint32_t>(std::ceil(static_cast<float>(settings.arenaSize.y) / mCellSize)) + 1u;
+
+    const auto kCells = static_cast<std::size_t>(mGridWidth) * mGridHeight;
+    const auto kThreads = settings.gridThreads ? settings.gridThreads : 1u;
+
+    mCellStarts.resize(kCells + 1);
+    mThreadCells.resize(kCells * kThreads);
+
+    mWorkers = std::make_unique<WorkerGroup>(kThreads);
+
+    paddleY[0] = paddleY[1] = static_cast<float>(settings.arenaSize.y) / 2.0f;
+}
+
+MultiBallWorld::~MultiBallWorld() noexcept = default;
+
+void MultiBallWorld::Reserve(std::size_t capacity) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(capacity > ballX.size());
+
+    for (auto* array : { &ballX, &ballY, &velocityX, &velocityY })
+    {
+        array->resize(capacity);
+    }
+
+    mBallCells.resize(capacity);
+    mScratchCells.resize(capacity);
+    mCellBalls.resize(capacity);
+
+    for (auto& scratch : mScratch)
+    {
+        scratch.resize(capacity);
+    }
+}
+
+std::size_t MultiBallWorld::Spawn() noexcept
+{
+    if (mSize == ballX.size())
+    {
+        Reserve(mSize ? mSize * 2 : 64);
+    }
+
+    PlaceBall(mSize);
+    return mSize++;
+}
+
+void MultiBallWorld::Remove(std::size_t index) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(index < mSize);
+
+    --mSize;
+
+    ballX[index] = ballX[mSize];
+    ballY[index] = ballY[mSize];
+    velocityX[index] = velocityX[mSize];
+    velocityY[index] = velocityY[mSize];
+}
+
+void MultiBallWorld::Step(float delta, const PaddleAction (&actions)[2]) noexcept
+{
+    MovePaddles(delta, actions);
+    MoveBalls(delta);
+
+    mTestedPairs = 0;
+
+    BuildGrid();
+
+    if (mSettings.ballCollisions)
+    {
+        CollideBalls();
+    }
+
+    CollidePaddles();
+}
+
+void MultiBallWorld::PlaceBall(std::size_t index) noexcept
+{
+    const auto kWidth = static_cast<float>(mSettings.arenaSize.x);
+    const auto kHeight = static_cast<float>(mSettings.arenaSize.y);
+    const auto kRadius = mSettings.ballRadius;
+
+    // Spread over the middle half so that respawned balls don't pile up.
+    ballX[index] = kWidth * 0.25f + mRandom.NextFloat() * kWidth * 0.5f;
+    ballY[index] = kRadius + mRandom.NextFloat() * (kHeight - 2.0f * kRadius);
+
+    const auto kAngle = (mRandom.NextFloat() - 0.5f) * 1.5f;
+    const auto kSide = mRandom.NextSignFloat();
+
+    velocityX[index] = std::cos(kAngle) * kSide * mSettings.ballSpeed;
+    velocityY[index] = std::sin(kAngle) * mSettings.ballSpeed;
+}
+
+void MultiBallWorld::MovePaddles(float delta, const PaddleAction (&actions)[2]) noexcept
+{
+    const auto kHeight = static_cast<float>(mSettings.arenaSize.y);
+
+    for (auto p = 0; p < 2; ++p)
+    {
+        auto direction = 0.0f;
+        direction = actions[p] == PaddleAction::Up ? 1.0f : direction;
+        direction = actions[p] == PaddleAction::Down ? -1.0f : direction;
+
+        const auto kY = paddleY[p] + direction * Paddle::skDefaultMoveSpeed * delta;
+
+        // Same limits as Paddle::CollideWithTerrain.
+        const auto kCollidesTop = kY + skPaddleMinTerrainOffset > kHeight - skPaddleHalfHeight;
+        const auto kCollidesBottom = kY - skPaddleMinTerrainOffset < skPaddleHalfHeight;
+
+        paddleY[p] = kCollidesTop || kCollidesBottom ? paddleY[p] : kY;
+    }
+}
+
+void MultiBallWorld::MoveBalls(float delta) noexcept
+{
+    const auto kWidth = static_cast<float>(mSettings.arenaSize.x);
+    const auto kHeight = static_cast<float>(mSettings.arenaSize.y);
+    const auto kRadius = mSettings.ballRadius;
+
+    auto* x = ballX.data();
+    auto* y = ballY.data();
+    auto* vx = velocityX.data();
+    auto* vy = velocityY.data();
+
+    // Branch-free so that it vectorizes.
+    for (std::size_t i = 0; i < mSize; ++i)
+    {
+        x[i] += vx[i] * delta;
+        y[i] += vy[i] * delta;
+
+        const auto kBounces = (y[i] > kHeight - kRadius && vy[i] > 0.0f) || (y[i] < kRadius && vy[i] < 0.0f);
+        vy[i] = kBounces ? -vy[i] : vy[i];
+    }
+
+    // Scoring is rare, respawned balls are placed where they can't score again this tick.
+    for (std::size_t i = 0; i < mSize; ++i)
+    {
+        if (x[i] < kRadius || x[i] > kWidth - kRadius)
+        {
+            ++scores[x[i] < kRadius ? 1 : 0];
+            PlaceBall(i);
+        }
+    }
+}
+
+std::uint32_t MultiBallWorld::GetCellX(float x) const noexcept
+{
+    const auto kCell = static_cast<int>(x / mCellSize) + 1;
+    const auto kLast = static_cast<int>(mGridWidth) - 2;
+
+    return static_cast<std::uint32_t>(kCell < 1 ? 1 : (kCell > kLast ? kLast : kCell));
+}
+
+std::uint32_t MultiBallWorld::GetCellY(float y) const noexcept
+{
+    const auto kCell = static_cast<int>(y / mCellSize);
+    const auto kLast = static_cast<int>(mGridHeight) - 2;
+
+    return static_cast<std::uint32_t>(kCell < 0 ? 0 : (kCell > kLast ? kLast : kCell));
+}
+
+void MultiBallWorld::BuildGrid() noexcept
+{
+    const auto kCells = static_cast<std::size_t>(mGridWidth) * mGridHeight;
+    const auto kThreads = mWorkers->GetThreadCount();
+
+    // Each thread counts the balls of its range per cell.
+    mWorkers->Run(&MultiBallWorld::CountCells, this);
+
+    // Turns the counts into write offsets. Within a cell, the balls of thread 0 come first, then the balls of thread 1
+    // and so on, which keeps the balls in index order for any thread count.
+    std::uint32_t offset = 0;
+
+    for (std::size_t c = 0; c < kCells; ++c)
+    {
+        mCellStarts[c] = offset;
+
+        for (std::size_t t = 0; t < kThreads; ++t)
+        {
+            auto& count = mThreadCells[t * kCells + c];
+            const auto kCount = count;
+
+            count = offset;
+            offset += kCount;
+        }
+    }
+
+    mCellStarts[kCells] = offset;
+
+    mWorkers->Run(&MultiBallWorld::ScatterCells, this);
+    mWorkers->Run(&MultiBallWorld::ReorderBalls, this);
+
+    std::swap(ballX, mScratch[0]);
+    std::swap(ballY, mScratch[1]);
+    std::swap(velocityX, mScratch[2]);
+    std::swap(velocityY, mScratch[3]);
+    std::swap(mBallCells, mScratchCells);
+}
+
+void MultiBallWorld::CountCells(void* userData, unsigned thread, unsigned threadCount) noexcept
+{
+    auto& world = *static_cast<MultiBallWorld*>(userData);
+
+    const auto kCells = static_cast<std::size_t>(world.mGridWidth) * world.mGridHeight;
+    const auto kBegin = world.mSize * thread / threadCount;
+    const auto kEnd = world.mSize * (thread + 1) / threadCount;
+
+    auto* counts = world.mThreadCells.data() + thread * kCells;
+    std::fill(counts, counts + kCells, 0u);
+
+    for (auto i = kBegin; i < kEnd; ++i)
+    {
+        const auto kCell = world.GetCellY(world.ballY[i]) * world.mGridWidth + world.GetCellX(world.ballX[i]);
+
+        world.mBallCells[i] = kCell;
+        ++counts[kCell];
+    }
+}
+
+void MultiBallWorld::ScatterCells(void* userData, unsigned thread, unsigned threadCount) noexcept
+{
+    auto& world = *static_cast<MultiBallWorld*>(userData);
+
+    const auto kCells = static_cast<std::size_t>(world.mGridWidth) * world.mGridHeight;
+    const auto kBegin = world.mSize * thread / threadCount;
+    const auto kEnd = world.mSize * (thread + 1) / threadCount;
+
+    auto* offsets = world.mThreadCells.data() + thread * kCells;
+
+    for (auto i = kBegin; i < kEnd; ++i)
+    {
+        world.mCellBalls[offsets[world.mBallCells[i]]++] = static_cast<std::uint32_t>(i);
+    }
+}
+
+void MultiBallWorld::ReorderBalls(void* userData, unsigned thread, unsigned threadCount) noexcept
+{
+    auto& world = *static_cast<MultiBallWorld*>(userData);
+
+    const auto kBegin = world.mSize * thread / threadCount;
+    const auto kEnd = world.mSize * (thread + 1) / threadCount;
+
+    const auto* order = world.mCellBalls.data();
+
+    const auto kGather = [&](const std::vector<float>& from, std::vector<float>& to)
+    {
+        for (auto i = kBegin; i < kEnd; ++i)
+        {
+            to[i] = from[order[i]];
+        }
+    };
+
+    kGather(world.ballX, world.mScratch[0]);
+    kGather(world.ballY, world.mScratch[1]);
+    kGather(world.velocityX, world.mScratch[2]);
+    kGather(world.velocityY, world.mScratch[3]);
+
+    for (auto i = kBegin; i < kEnd; ++i)
+    {
+        world.mScratchCells[i] = world.mBallCells[order[i]];
+    }
+}
+
+void MultiBallWorld::CollideBalls() noexcept
+{
+    const auto* starts = mCellStarts.data();
+    const auto* cells = mBallCells.data();
+
+    for (std::uint32_t i = 0; i < mSize; ++i)
+    {
+        const auto kCell = cells[i];
+        const auto kBelow = kCell + mGridWidth;
+
+        // Half of the neighbourhood so that each pair is only tested once. The rest of the cell and the cell on the
+        // right are one range, the three cells below are another. The padding cells are empty.
+        CollideBallWithRange(i, i + 1, starts[kCell + 2]);
+        CollideBallWithRange(i, starts[kBelow - 1], starts[kBelow + 2]);
+    }
+}
+
+void MultiBallWorld::CollideBallWithRange(std::uint32_t ball, std::uint32_t begin, std::uint32_t end) noexcept
+{
+    const auto kDiameter = mSettings.ballRadius * 2.0f;
+
+    auto* x = ballX.data();
+    auto* y = ballY.data();
+    auto* vx = velocityX.data();
+    auto* vy = velocityY.data();
+
+    mTestedPairs += end - begin;
+
+    for (auto other = begin; other < end; ++other)
+    {
+        const auto kDX = x[other] - x[ball];
+        const auto kDY = y[other] - y[ball];
+        const auto kSquareDistance = kDX * kDX + kDY * kDY;
+
+        if (kSquareDistance >= kDiameter * kDiameter || kSquareDistance == 0.0f)
+        {
+            continue;
+        }
+
+        const auto kDistance = std::sqrt(kSquareDistance);
+        const auto kInverseDistance = 1.0f / kDistance;
+
+        const auto kNormalX = kDX * kInverseDistance;
+        const auto kNormalY = kDY * kInverseDistance;
+
+        // Push the balls apart evenly.
+        const auto kPush = (kDiameter - kDistance) * 0.5f;
+
+        x[ball] -= kNormalX * kPush;
+        y[ball] -= kNormalY * kPush;
+        x[other] += kNormalX * kPush;
+        y[other] += kNormalY * kPush;
+
+        // Equal masses swap their velocities along the normal, only if they move toward each other.
+        const auto kApproach = (vx[other] - vx[ball]) * kNormalX + (vy[other] - vy[ball]) * kNormalY;
+
+        if (kApproach < 0.0f)
+        {
+            vx[ball] += kNormalX * kApproach;
+            vy[ball] += kNormalY * kApproach;
+            vx[other] -= kNormalX * kApproach;
+            vy[other] -= kNormalY * kApproach;
+        }
+    }
+}
+
+void MultiBallWorld::CollidePaddles() noexcept
+{
+    const auto kRadius = mSettings.ballRadius;
+    const auto kWidth = static_cast<float>(mSettings.arenaSize.x);
+
+    for (auto p = 0; p < 2; ++p)
+    {
+        const auto kPaddleX = p ? kWidth - Match::skPaddleBorderOffset : Match::skPaddleBorderOffset;
+        const auto kForward = skPaddleForward[p];
+
+        // The cells the paddle grown by a radius covers.
+        const auto kMinX = GetCellX(kPaddleX - skPaddleHalfWidth - kRadius);
+        const auto kMaxX = GetCellX(kPaddleX + skPaddleHalfWidth + kRadius);
+        const auto kMinY = GetCellY(paddleY[p] - skPaddleHalfHeight - kRadius);
+        const auto kMaxY = GetCellY(paddleY[p] + skPaddleHalfHeight + kRadius);
+
+        for (auto y = kMinY; y <= kMaxY; ++y)
+        {
+            for (auto x = kMinX; x <= kMaxX; ++x)
+            {
+                const auto kCell = y * mGridWidth + x;
+
+                for (auto ball = mCellStarts[kCell]; ball < mCellStarts[kCell + 1]; ++ball)
+                {
+                    // Moving away already, same as Ball::CollideWith.
+                    if (velocityX[ball] * kForward >= 0.0f)
+                    {
+                        continue;
+                    }
+
+                    // Circle against box: the closest point of the box to the center.
+                    const auto kClosestX = std::fmax(kPaddleX - skPaddleHalfWidth, std::fmin(ballX[ball], kPaddleX + skPaddleHalfWidth));
+                    const auto kClosestY = std::fmax(paddleY[p] - skPaddleHalfHeight, std::fmin(ballY[ball], paddleY[p] + skPaddleHalfHeight));
+
+                    const auto kDX = ballX[ball] - kClosestX;
+                    const auto kDY = ballY[ball] - kClosestY;
+
+                    if (kDX * kDX + kDY * kDY >= kRadius * kRadius)
+                    {
+                        continue;
+                    }
+
+                    // Same response as Ball::OnPaddleCollision without the speed up, away from the paddle center.
+                    const auto kAwayX = ballX[ball] - kPaddleX;
+                    const auto kAwayY = ballY[ball] - paddleY[p];
+                    const auto kAwayLength = std::sqrt(kAwayX * kAwayX + kAwayY * kAwayY);
+
+                    const auto kSpeed = std::sqrt(velocityX[ball] * velocityX[ball] + velocityY[ball] * velocityY[ball]);
+
+                    velocityX[ball] = kAwayX / kAwayLength * kSpeed;
+                    velocityY[ball] = kAwayY / kAwayLength * kSpeed;
+                }
+            }
+        }
+    }
+}
+
+} // namespace lepong
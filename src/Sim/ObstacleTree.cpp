@@ -0,0 +1,311 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "lepong/Check.h"
+#include "lepong/Math/Collision.h"
+#include "lepong/Sim/ObstacleTree.h"
+
+namespace lepong
+{
+
+static constexpr auto skInfinity = std::numeric_limits<float>::infinity();
+
+// The depth of a tree over 2^32 obstacles split at the median, with room to spare. Traversal stacks never hold more
+// than one entry per level plus one.
+static constexpr unsigned skMaxDepth = 64;
+
+// Stands for 1 / 0 in box tests. Infinity would give NaN for a start exactly on a face.
+static constexpr auto skHugeInverse = 1e30f;
+
+LEPONG_NODISCARD static float GetInverse(float motion) noexcept
+{
+    return motion != 0.0f ? 1.0f / motion : std::copysign(skHugeInverse, motion);
+}
+
+///
+/// Tests the motion from <i>start</i> against the box [min, max], with the slab method.
+///
+/// \param inverse One over the motion, see <i>GetInverse</i>.
+/// \param enter Set to the fraction of the motion before entering the box, negative if the start is inside.
+///
+/// \return Whether the box is entered before <i>best</i>. Empty boxes, with min > max, are never entered.
+///
+LEPONG_NODISCARD static bool EnterBox(
+    const Vector2f& min, const Vector2f& max, float startX, float startY, float inverseX, float inverseY, float best,
+    float& enter) noexcept
+{
+    const auto kX1 = (min.x - startX) * inverseX;
+    const auto kX2 = (max.x - startX) * inverseX;
+    const auto kY1 = (min.y - startY) * inverseY;
+    const auto kY2 = (max.y - startY) * inverseY;
+
+    // std::min and std::max rather than fmin and fmax, which handle NaN and aren't always inlined. There is no NaN here.
+    enter = std::max(std::min(kX1, kX2), std::min(kY1, kY2));
+    const auto kExit = std::min(std::max(kX1, kX2), std::max(kY1, kY2));
+
+    return min.x <= max.x && enter <= kExit && kExit >= 0.0f && enter <= best;
+}
+
+void ObstacleTree::Build(const std::vector<Obstacle>& obstacles) noexcept
+{
+    const auto kCount = static_cast<std::uint32_t>(obstacles.size());
+
+    mNodes.clear();
+    mParents.clear();
+
+    mOrder.resize(kCount);
+    std::iota(mOrder.begin(), mOrder.end(), 0u);
+
+    mObstacles.resize(kCount);
+    mAlive.assign(kCount, 1u);
+    mLeaves.resize(kCount);
+    mSlots.resize(kCount);
+
+    mAliveCount = kCount;
+    mDepth = 0;
+
+    LEPONG_CHECK_OR_RETURN(kCount);
+
+    mNodes.emplace_back();
+    mParents.push_back(0u);
+
+    BuildNode(0u, 0u, kCount, obstacles, 1u);
+
+    for (std::uint32_t slot = 0; slot < kCount; ++slot)
+    {
+        mObstacles[slot] = obstacles[mOrder[slot]];
+        mSlots[mOrder[slot]] = slot;
+    }
+
+    RestoreAll();
+}
+
+void ObstacleTree::BuildNode(
+    std::uint32_t node, std::uint32_t begin, std::uint32_t end, const std::vector<Obstacle>& obstacles, unsigned depth) noexcept
+{
+    mDepth = std::max(mDepth, depth);
+
+    if (end - begin <= skLeafSize)
+    {
+        mNodes[node].first = begin;
+        mNodes[node].count = end - begin;
+
+        for (auto i = begin; i < end; ++i)
+        {
+            mLeaves[i] = node;
+        }
+
+        return;
+    }
+
+    Vector2f min = { skInfinity, skInfinity };
+    Vector2f max = { -skInfinity, -skInfinity };
+
+    for (auto i = begin; i < end; ++i)
+    {
+        const auto& kCenter = obstacles[mOrder[i]].center;
+
+        min = { std::fmin(min.x, kCenter.x), std::fmin(min.y, kCenter.y) };
+        max = { std::fmax(max.x, kCenter.x), std::fmax(max.y, kCenter.y) };
+    }
+
+    const auto kSplitY = (max.y - min.y) > (max.x - min.x);
+    const auto kMiddle = begin + (end - begin) / 2u;
+
+    std::nth_element(mOrder.begin() + begin, mOrder.begin() + kMiddle, mOrder.begin() + end, [&](std::uint32_t a, std::uint32_t b)
+    {
+        return kSplitY ? obstacles[a].center.y < obstacles[b].center.y : obstacles[a].center.x < obstacles[b].center.x;
+    });
+
+    // Children are added after their parent, so refitting the nodes in reverse order goes bottom up.
+    const auto kChildren = static_cast<std::uint32_t>(mNodes.size());
+
+    mNodes.resize(kChildren + 2u);
+    mParents.resize(kChildren + 2u, node);
+
+    mNodes[node].first = kChildren;
+    mNodes[node].count = 0u;
+
+    BuildNode(kChildren, begin, kMiddle, obstacles, depth + 1u);
+    BuildNode(kChildren + 1u, kMiddle, end, obstacles, depth + 1u);
+}
+
+void ObstacleTree::Remove(std::uint32_t obstacle) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(obstacle < mSlots.size());
+
+    const auto kSlot = mSlots[obstacle];
+    LEPONG_CHECK_OR_RETURN(mAlive[kSlot]);
+
+    mAlive[kSlot] = 0u;
+    --mAliveCount;
+
+    // The ancestors above the first node that keeps its bounds keep theirs too.
+    for (auto node = mLeaves[kSlot]; RefitNode(node) && node != 0u; node = mParents[node])
+    {
+    }
+}
+
+void ObstacleTree::RestoreAll() noexcept
+{
+    std::fill(mAlive.begin(), mAlive.end(), 1u);
+    mAliveCount = mAlive.size();
+
+    for (auto node = static_cast<std::uint32_t>(mNodes.size()); node-- > 0u;)
+    {
+        static_cast<void>(RefitNode(node));
+    }
+}
+
+bool ObstacleTree::RefitNode(std::uint32_t node) noexcept
+{
+    auto& refit = mNodes[node];
+
+    Vector2f min = { skInfinity, skInfinity };
+    Vector2f max = { -skInfinity, -skInfinity };
+
+    if (refit.count)
+    {
+        for (auto i = refit.first; i < refit.first + refit.count; ++i)
+        {
+            if (!mAlive[i])
+            {
+                continue;
+            }
+
+            const auto& kObstacle = mObstacles[i];
+
+            min = { std::fmin(min.x, kObstacle.center.x - kObstacle.halfSize.x), std::fmin(min.y, kObstacle.center.y - kObstacle.halfSize.y) };
+            max = { std::fmax(max.x, kObstacle.center.x + kObstacle.halfSize.x), std::fmax(max.y, kObstacle.center.y + kObstacle.halfSize.y) };
+        }
+    }
+    else
+    {
+        for (const auto kChild : { refit.first, refit.first + 1u })
+        {
+            const auto& kChildNode = mNodes[kChild];
+
+            min = { std::fmin(min.x, kChildNode.min.x), std::fmin(min.y, kChildNode.min.y) };
+            max = { std::fmax(max.x, kChildNode.max.x), std::fmax(max.y, kChildNode.max.y) };
+        }
+    }
+
+    const auto kChanged = min.x != refit.min.x || min.y != refit.min.y || max.x != refit.max.x || max.y != refit.max.y;
+
+    refit.min = min;
+    refit.max = max;
+
+    return kChanged;
+}
+
+bool ObstacleTree::SweepCircle(const Vector2f& center, float radius, const Vector2f& motion, ObstacleHit& hit) const noexcept
+{
+    hit = ObstacleHit{};
+    LEPONG_CHECK_OR_RETURN_VAL(!mNodes.empty(), false);
+
+    const auto kInverseX = GetInverse(motion.x);
+    const auto kInverseY = GetInverse(motion.y);
+    const Vector2f kGrow = { radius, radius };
+
+    struct Entry
+    {
+        std::uint32_t node;
+        float enter;
+    } stack[skMaxDepth];
+
+    auto size = 0u;
+    auto best = 1.0f;
+
+    const auto kPush = [&](std::uint32_t node, float enter)
+    {
+        stack[size++] = { node, enter };
+    };
+
+    auto enter = 0.0f;
+
+    if (EnterBox(mNodes[0].min - kGrow, mNodes[0].max + kGrow, center.x, center.y, kInverseX, kInverseY, best, enter))
+    {
+        kPush(0u, enter);
+    }
+
+    while (size)
+    {
+        const auto kEntry = stack[--size];
+
+        // A closer hit was found since the node was pushed.
+        if (kEntry.enter > best)
+        {
+            continue;
+        }
+
+        const auto& kNode = mNodes[kEntry.node];
+
+        if (kNode.count)
+        {
+            for (auto i = kNode.first; i < kNode.first + kNode.count; ++i)
+            {
+                SweepHit sweep;
+
+                if (!mAlive[i] || !SweepCircleAabb(center, radius, motion, mObstacles[i].center, mObstacles[i].halfSize, sweep))
+                {
+                    continue;
+                }
+
+                // The first obstacle found wins ties, the order nodes are visited in is fixed.
+                if (hit.obstacle == ObstacleHit::skNone ? sweep.time <= best : sweep.time < best)
+                {
+                    best = sweep.time;
+
+                    hit.obstacle = mOrder[i];
+                    hit.time = sweep.time;
+                    hit.normal = sweep.normal;
+                }
+            }
+
+            continue;
+        }
+
+        float enters[2];
+        bool entered[2];
+
+        for (auto c = 0u; c < 2u; ++c)
+        {
+            const auto& kChild = mNodes[kNode.first + c];
+            entered[c] = EnterBox(kChild.min - kGrow, kChild.max + kGrow, center.x, center.y, kInverseX, kInverseY, best, enters[c]);
+        }
+
+        // The nearest child is pushed last so that it is visited first.
+        const auto kFar = enters[0] > enters[1] ? 0u : 1u;
+
+        for (const auto c : { kFar, 1u - kFar })
+        {
+            if (entered[c])
+            {
+                kPush(kNode.first + c, enters[c]);
+            }
+        }
+    }
+
+    return hit.obstacle != ObstacleHit::skNone;
+}
+
+std::size_t ObstacleTree::SweepCircles(
+    const Vector2f* centers, const Vector2f* motions, std::size_t count, float radius, ObstacleHit* hits) const noexcept
+{
+    std::size_t hitCount = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        hitCount += SweepCircle(centers[i], radius, motions[i], hits[i]) ? 1u : 0u;
+    }
+
+    return hitCount;
+}
+
+} // namespace lepong
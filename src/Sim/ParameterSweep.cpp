@@ -0,0 +1,389 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <iterator> // For std::size.
+#include <thread>
+
+#include "lepong/Sim/ParameterSweep.h"
+
+#include "WorkerGroup.h"
+
+namespace lepong
+{
+
+void StreamingStats::Add(double value) noexcept
+{
+    ++mCount;
+
+    const auto kDelta = value - mMean;
+    mMean += kDelta / static_cast<double>(mCount);
+    mM2 += kDelta * (value - mMean);
+
+    mMin = mCount > 1u ? std::min(mMin, value) : value;
+    mMax = mCount > 1u ? std::max(mMax, value) : value;
+
+    ++mBuckets[GetBucket(value)];
+}
+
+void StreamingStats::Merge(const StreamingStats& other) noexcept
+{
+    if (!other.mCount)
+    {
+        return;
+    }
+
+    if (!mCount)
+    {
+        *this = other;
+        return;
+    }
+
+    const auto kCount = static_cast<double>(mCount + other.mCount);
+    const auto kDelta = other.mMean - mMean;
+    const auto kWeight = static_cast<double>(mCount) * static_cast<double>(other.mCount) / kCount;
+
+    mMean += kDelta * static_cast<double>(other.mCount) / kCount;
+    mM2 += other.mM2 + kDelta * kDelta * kWeight;
+    mCount += other.mCount;
+
+    mMin = std::min(mMin, other.mMin);
+    mMax = std::max(mMax, other.mMax);
+
+    for (auto i = 0u; i < skBucketCount; ++i)
+    {
+        mBuckets[i] += other.mBuckets[i];
+    }
+}
+
+double StreamingStats::GetStandardDeviation() const noexcept
+{
+    return std::sqrt(GetVariance());
+}
+
+double StreamingStats::GetQuantile(double q) const noexcept
+{
+    if (!mCount)
+    {
+        return 0.0;
+    }
+
+    const auto kRank = std::max(std::ceil(q * static_cast<double>(mCount)), 1.0);
+    std::uint64_t seen = 0;
+
+    for (auto i = 0u; i < skBucketCount; ++i)
+    {
+        seen += mBuckets[i];
+
+        if (static_cast<double>(seen) >= kRank)
+        {
+            return std::clamp(GetBucketEnd(i), mMin, mMax);
+        }
+    }
+
+    return mMax;
+}
+
+unsigned StreamingStats::GetBucket(double value) noexcept
+{
+    if (!(value > 0.0))
+    {
+        return 0u;
+    }
+
+    // value = mantissa * 2^exponent with the mantissa in [0.5, 1).
+    int exponent;
+    const auto kMantissa = std::frexp(value, &exponent);
+
+    const auto kOctave = exponent - 1 - skMinExponent;
+    const auto kStep = static_cast<int>((kMantissa * 2.0 - 1.0) * skBucketsPerOctave);
+    const auto kBucket = kOctave * static_cast<int>(skBucketsPerOctave) + kStep;
+
+    return static_cast<unsigned>(std::clamp(kBucket, 0, static_cast<int>(skBucketCount) - 1));
+}
+
+double StreamingStats::GetBucketEnd(unsigned bucket) noexcept
+{
+    const auto kOctave = static_cast<int>(bucket / skBucketsPerOctave) + skMinExponent;
+    const auto kStep = static_cast<double>(bucket % skBucketsPerOctave + 1u);
+
+    return std::ldexp(1.0 + kStep / skBucketsPerOctave, kOctave);
+}
+
+void SweepResult::Merge(const SweepResult& other) noexcept
+{
+    rallyLength.Merge(other.rallyLength);
+    pointTime.Merge(other.pointTime);
+    pointShare.Merge(other.pointShare);
+
+    matches += other.matches;
+    wins[0] += other.wins[0];
+    wins[1] += other.wins[1];
+    timeouts += other.timeouts;
+    ticks += other.ticks;
+}
+
+ParameterSweep::ParameterSweep(const SweepSettings& settings) noexcept
+    : mSettings(settings)
+{
+    const SweepRange* kRanges[] =
+    {
+        &settings.ballSpeed,
+        &settings.paddleSpeed,
+        &settings.hitSpeedGain,
+        &settings.graceZone,
+        &settings.paddleHeight
+    };
+
+    std::size_t size = 1;
+
+    for (const auto* range : kRanges)
+    {
+        size *= std::max(range->steps, 1u);
+    }
+
+    mGrid.resize(size);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        // The configuration index written in the mixed radix of the step counts, the last range being the lowest digit.
+        float values[std::size(kRanges)];
+        auto rest = i;
+
+        for (auto r = std::size(kRanges); r-- > 0;)
+        {
+            const auto kSteps = std::max(kRanges[r]->steps, 1u);
+
+            values[r] = kRanges[r]->Get(static_cast<unsigned>(rest % kSteps));
+            rest /= kSteps;
+        }
+
+        auto& rules = mGrid[i];
+
+        rules.ballSpeed = values[0];
+        rules.paddleSpeed = values[1];
+        rules.hitSpeedGain = values[2];
+        rules.graceZone = values[3];
+        rules.paddleHeight = values[4];
+    }
+
+    auto threads = settings.threads ? settings.threads : std::thread::hardware_concurrency();
+    threads = threads ? threads : 1u;
+
+    const auto kChunkSize = std::max(settings.chunk, 1ull);
+    mChunkCount = static_cast<std::size_t>(std::max((settings.matches + kChunkSize - 1u) / kChunkSize, 1ull));
+
+    // A chunk is never split between threads.
+    mThreadCount = static_cast<unsigned>(std::min<std::size_t>(threads, size * mChunkCount));
+}
+
+void ParameterSweep::Run() noexcept
+{
+    mResults.assign(mGrid.size(), SweepResult{});
+
+    mChunks.clear();
+    mChunks.resize(mGrid.size() * mChunkCount);
+
+    // Value initialized, every count starts at 0.
+    mFinished = std::vector<std::atomic<std::size_t>>(mGrid.size());
+
+    mNext.store(0, std::memory_order_relaxed);
+
+    WorkerGroup workers(mThreadCount);
+    workers.Run(&ParameterSweep::PlayChunks, this);
+}
+
+std::uint64_t ParameterSweep::GetTickCount() const noexcept
+{
+    std::uint64_t ticks = 0;
+
+    for (const auto& kResult : mResults)
+    {
+        ticks += kResult.ticks;
+    }
+
+    return ticks;
+}
+
+void ParameterSweep::PlayChunks(void* userData, unsigned, unsigned) noexcept
+{
+    auto& sweep = *static_cast<ParameterSweep*>(userData);
+
+    for (auto i = sweep.mNext.fetch_add(1); i < sweep.mChunks.size(); i = sweep.mNext.fetch_add(1))
+    {
+        const auto kConfiguration = i / sweep.mChunkCount;
+
+        auto result = std::make_unique<SweepResult>();
+        sweep.PlayChunk(kConfiguration, i % sweep.mChunkCount, *result);
+        sweep.mChunks[i] = std::move(result);
+
+        // Acquire and release, the thread finishing the last chunk sees the results of the others.
+        if (sweep.mFinished[kConfiguration].fetch_add(1, std::memory_order_acq_rel) + 1u == sweep.mChunkCount)
+        {
+            sweep.MergeChunks(kConfiguration);
+        }
+    }
+}
+
+void ParameterSweep::MergeChunks(std::size_t configuration) noexcept
+{
+    auto& result = mResults[configuration];
+    result.rules = mGrid[configuration];
+
+    for (std::size_t c = 0; c < mChunkCount; ++c)
+    {
+        auto& chunk = mChunks[configuration * mChunkCount + c];
+
+        result.Merge(*chunk);
+        chunk.reset();
+    }
+}
+
+///
+/// What a lane keeps of the point and match it is playing.
+///
+struct SweepLane
+{
+    std::uint32_t ticks = 0;
+    std::uint32_t hits = 0;
+
+    // The horizontal direction of the ball last tick, paddle hits flip it.
+    float dirX = 0.0f;
+
+    bool active = false;
+};
+
+///
+/// Same logic as <i>FillTrackBallActions</i> with a dead zone per player.
+///
+static void FillActions(const MatchBatch& batch, const float (&deadZones)[2], PaddleAction* actions) noexcept
+{
+    const auto kSize = batch.Size();
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        auto* playerActions = actions + p * kSize;
+        const auto kDeadZone = deadZones[p];
+
+        for (std::size_t i = 0; i < kSize; ++i)
+        {
+            const auto kOffset = batch.ballY[i] - batch.paddleY[p][i];
+
+            const auto kUp = kOffset > kDeadZone ? 1 : 0;
+            const auto kDown = kOffset < -kDeadZone ? 2 : 0;
+
+            playerActions[i] = static_cast<PaddleAction>(kUp | kDown);
+        }
+    }
+}
+
+void ParameterSweep::PlayChunk(std::size_t configuration, std::size_t chunk, SweepResult& result) noexcept
+{
+    const auto kChunkSize = std::max(mSettings.chunk, 1ull);
+    const auto kFirstMatch = static_cast<unsigned long long>(chunk) * kChunkSize;
+    const auto kMatches = std::min(mSettings.matches - kFirstMatch, kChunkSize);
+
+    const auto kLaneCount = static_cast<std::size_t>(std::max(std::min<unsigned long long>(mSettings.lanes, kMatches), 1ull));
+    const auto kMaxTicks = static_cast<std::uint32_t>(std::min(mSettings.maxPointTime / mSettings.delta, 4e9f));
+    const auto kDelta = static_cast<double>(mSettings.delta);
+
+    MatchBatch batch(kLaneCount);
+    batch.SetKernel(mSettings.kernel);
+    batch.SetRules(mGrid[configuration]);
+
+    // A chunk has fewer lanes than matches, starting its streams at its first match gives every chunk its own.
+    batch.SetSeed(mSettings.seed, kFirstMatch);
+
+    std::vector<SweepLane> lanes(kLaneCount);
+    std::vector<PaddleAction> actions(2 * kLaneCount);
+
+    unsigned long long started = 0;
+    std::size_t active = 0;
+
+    for (std::size_t i = 0; i < kLaneCount && started < kMatches; ++i, ++started, ++active)
+    {
+        batch.Launch(i);
+
+        lanes[i].active = true;
+        lanes[i].dirX = batch.ballDirX[i];
+    }
+
+    while (active)
+    {
+        FillActions(batch, mSettings.deadZones, actions.data());
+        batch.Step(mSettings.delta, actions.data());
+
+        result.ticks += active;
+
+        for (std::size_t i = 0; i < kLaneCount; ++i)
+        {
+            auto& lane = lanes[i];
+
+            if (!lane.active)
+            {
+                continue;
+            }
+
+            auto matchOver = false;
+
+            if (batch.playing[i])
+            {
+                const auto kDirX = batch.ballDirX[i];
+
+                lane.hits += kDirX * lane.dirX < 0.0f ? 1u : 0u;
+                lane.dirX = kDirX;
+
+                if (++lane.ticks < kMaxTicks)
+                {
+                    continue;
+                }
+
+                // The rules may let rallies go on forever, the match would never end.
+                ++result.timeouts;
+                matchOver = true;
+            }
+            else
+            {
+                result.rallyLength.Add(lane.hits);
+                result.pointTime.Add(static_cast<double>(lane.ticks + 1u) * kDelta);
+
+                const auto kFirst = batch.scores[0][i];
+                const auto kSecond = batch.scores[1][i];
+
+                if (kFirst >= mSettings.points || kSecond >= mSettings.points)
+                {
+                    ++result.matches;
+                    ++result.wins[kSecond > kFirst ? 1 : 0];
+
+                    result.pointShare.Add(static_cast<double>(kFirst) / static_cast<double>(kFirst + kSecond));
+                    matchOver = true;
+                }
+            }
+
+            if (matchOver)
+            {
+                batch.Restart(i);
+
+                if (started == kMatches)
+                {
+                    lane.active = false;
+                    --active;
+
+                    continue;
+                }
+
+                ++started;
+            }
+
+            lane.ticks = 0;
+            lane.hits = 0;
+
+            batch.Launch(i);
+            lane.dirX = batch.ballDirX[i];
+        }
+    }
+}
+
+} // namespace lepong
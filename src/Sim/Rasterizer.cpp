@@ -0,0 +1,176 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "lepong/Cpu.h"
+
+#include "RasterizerKernel.h"
+
+namespace lepong
+{
+
+namespace RasterizerKernels
+{
+
+///
+/// \return The first column whose pixel center is at or right of <i>x</i>.
+///
+LEPONG_NODISCARD static int GetColumn(const Geometry& geometry, float x) noexcept
+{
+    return std::clamp(static_cast<int>(std::ceil(x / geometry.pixelWidth - 0.5f)), 0, static_cast<int>(Rasterizer::skFrameWidth));
+}
+
+///
+/// \return The first row whose pixel center is at or below <i>y</i>.
+///
+LEPONG_NODISCARD static int GetRow(const Geometry& geometry, float y) noexcept
+{
+    return std::clamp(static_cast<int>(std::ceil((geometry.arenaHeight - y) / geometry.pixelHeight - 0.5f)), 0, static_cast<int>(Rasterizer::skFrameHeight));
+}
+
+///
+/// \return The pixels whose centers are inside the rectangle, which are the ones OpenGL fills.
+///
+LEPONG_NODISCARD static Box GetBox(const Geometry& geometry, float x, float y, float halfWidth, float halfHeight) noexcept
+{
+    const auto kFirstColumn = GetColumn(geometry, x - halfWidth);
+    const auto kFirstRow = GetRow(geometry, y + halfHeight);
+
+    return {
+        kFirstColumn,
+        std::max(kFirstColumn, GetColumn(geometry, x + halfWidth)),
+        kFirstRow,
+        std::max(kFirstRow, GetRow(geometry, y - halfHeight))
+    };
+}
+
+Geometry GetGeometry(const MatchRules& rules) noexcept
+{
+    Geometry geometry; // NOLINT: every field is set below.
+
+    geometry.arenaHeight = rules.arenaSize.y;
+    geometry.pixelWidth = rules.arenaSize.x / static_cast<float>(Rasterizer::skFrameWidth);
+    geometry.pixelHeight = rules.arenaSize.y / static_cast<float>(Rasterizer::skFrameHeight);
+
+    geometry.ballRadius = rules.ballRadius;
+    geometry.inverseBallRadius = 1.0f / rules.ballRadius;
+
+    // Same as RuntimeRules::GetPaddleX.
+    geometry.paddleX[0] = rules.paddleBorderOffset;
+    geometry.paddleX[1] = rules.arenaSize.x - rules.paddleBorderOffset;
+    geometry.paddleHalfWidth = rules.paddleWidth / 2.0f;
+    geometry.paddleHalfHeight = rules.paddleHeight / 2.0f;
+
+    return geometry;
+}
+
+Scene GetScene(const MatchBatch& batch, const Geometry& geometry, std::size_t index) noexcept
+{
+    Scene scene; // NOLINT: every field is set below.
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        scene.paddles[p] = GetBox(geometry, geometry.paddleX[p], batch.paddleY[p][index], geometry.paddleHalfWidth, geometry.paddleHalfHeight);
+    }
+
+    scene.ballX = batch.ballX[index];
+    scene.ballY = batch.ballY[index];
+    scene.ball = GetBox(geometry, scene.ballX, scene.ballY, geometry.ballRadius, geometry.ballRadius);
+
+    return scene;
+}
+
+///
+/// Sets the pixels of <i>box</i> to <i>color</i>.
+///
+static void FillBox(const Box& box, std::uint8_t color, std::uint8_t* frame) noexcept
+{
+    for (auto row = box.firstRow; row < box.endRow; ++row)
+    {
+        auto* line = frame + row * Rasterizer::skFrameWidth;
+
+        // Boxes are a few pixels wide, calling memset for each row costs more than the loop.
+        for (auto column = box.firstColumn; column < box.endColumn; ++column)
+        {
+            line[column] = color;
+        }
+    }
+}
+
+void DrawPaddles(const Scene& scene, std::uint8_t* frame) noexcept
+{
+    // Drawn after the ball like the game does, covering it.
+    FillBox(scene.paddles[0], skPaddleColor, frame);
+    FillBox(scene.paddles[1], skPaddleColor, frame);
+}
+
+///
+/// MakeBallFragmentShader on the CPU: the glow fades with the cube of the square distance to the center, in radii.
+///
+LEPONG_NODISCARD static std::uint8_t ShadeBall(float dx, float dy, float inverseRadius) noexcept
+{
+    const auto kU = dx * inverseRadius;
+    const auto kV = dy * inverseRadius;
+    const auto kSquareDistance = kU * kU + kV * kV;
+
+    const auto kIntensity = std::min(std::max(1.0f - kSquareDistance * kSquareDistance * kSquareDistance, 0.0f), 1.0f);
+    return static_cast<std::uint8_t>(static_cast<int>(kIntensity * 255.0f + 0.5f));
+}
+
+void DrawScalar(const MatchBatch& batch, const Geometry& geometry, std::size_t begin, std::size_t end, std::uint8_t* frames) noexcept
+{
+    for (auto i = begin; i < end; ++i)
+    {
+        auto* frame = frames + (i - begin) * Rasterizer::skFrameSize;
+        std::memset(frame, 0, Rasterizer::skFrameSize);
+
+        const auto kScene = GetScene(batch, geometry, i);
+        const auto& kBall = kScene.ball;
+
+        for (auto row = kBall.firstRow; row < kBall.endRow; ++row)
+        {
+            auto* line = frame + row * Rasterizer::skFrameWidth;
+            const auto kDy = GetRowCenter(geometry, static_cast<float>(row)) - kScene.ballY;
+
+            for (auto column = kBall.firstColumn; column < kBall.endColumn; ++column)
+            {
+                line[column] = ShadeBall(GetColumnCenter(geometry, static_cast<float>(column)) - kScene.ballX, kDy, geometry.inverseBallRadius);
+            }
+        }
+
+        DrawPaddles(kScene, frame);
+    }
+}
+
+} // namespace RasterizerKernels
+
+namespace Rasterizer
+{
+
+void DrawMatch(const MatchBatch& batch, std::size_t index, std::uint8_t* frame) noexcept
+{
+    DrawMatches(batch, index, index + 1, frame);
+}
+
+void DrawMatches(const MatchBatch& batch, std::size_t begin, std::size_t end, std::uint8_t* frames) noexcept
+{
+    const auto kGeometry = RasterizerKernels::GetGeometry(batch.GetRules());
+
+#if defined(LEPONG_X86_KERNELS)
+    if (Cpu::HasSSE2())
+    {
+        RasterizerKernels::DrawSSE2(batch, kGeometry, begin, end, frames);
+        return;
+    }
+#endif
+
+    RasterizerKernels::DrawScalar(batch, kGeometry, begin, end, frames);
+}
+
+} // namespace Rasterizer
+
+} // namespace lepong
@@ -0,0 +1,93 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lepong/Sim/Rasterizer.h"
+
+// The frame drawing split between the geometry and the paddles, shared by every kernel, and the ball, shaded for each
+// instruction set.
+//
+// Like the batch kernels, the ball is shaded with the same operations in the same order so every kernel gives the
+// same bytes.
+
+namespace lepong::RasterizerKernels
+{
+
+static constexpr std::uint8_t skPaddleColor = 255u;
+
+///
+/// The sizes of the rules a batch plays with, and the scale from its arena to the frames.
+///
+struct Geometry
+{
+    float arenaHeight;
+
+    // Arena units per pixel.
+    float pixelWidth;
+    float pixelHeight;
+
+    float ballRadius;
+    float inverseBallRadius;
+
+    // Where the batch puts the paddles, their x positions never change.
+    float paddleX[2];
+    float paddleHalfWidth;
+    float paddleHalfHeight;
+};
+
+///
+/// The pixels [firstColumn, endColumn) x [firstRow, endRow) of a frame.
+///
+struct Box
+{
+    int firstColumn;
+    int endColumn;
+    int firstRow;
+    int endRow;
+};
+
+struct Scene
+{
+    Box paddles[2];
+
+    // The quad the ball is drawn on.
+    Box ball;
+
+    float ballX;
+    float ballY;
+};
+
+LEPONG_NODISCARD Geometry GetGeometry(const MatchRules& rules) noexcept;
+
+LEPONG_NODISCARD Scene GetScene(const MatchBatch& batch, const Geometry& geometry, std::size_t index) noexcept;
+
+void DrawPaddles(const Scene& scene, std::uint8_t* frame) noexcept;
+
+///
+/// \return The x position of the center of the pixels of <i>column</i>.
+///
+LEPONG_NODISCARD inline float GetColumnCenter(const Geometry& geometry, float column) noexcept
+{
+    return (column + 0.5f) * geometry.pixelWidth;
+}
+
+///
+/// \return The y position of the center of the pixels of <i>row</i>, rows going down from the top of the arena.
+///
+LEPONG_NODISCARD inline float GetRowCenter(const Geometry& geometry, float row) noexcept
+{
+    return geometry.arenaHeight - (row + 0.5f) * geometry.pixelHeight;
+}
+
+///
+/// Draws matches [begin, end) into <i>frames</i>.
+///
+void DrawScalar(const MatchBatch& batch, const Geometry& geometry, std::size_t begin, std::size_t end, std::uint8_t* frames) noexcept;
+void DrawSSE2(const MatchBatch& batch, const Geometry& geometry, std::size_t begin, std::size_t end, std::uint8_t* frames) noexcept;
+
+} // namespace lepong::RasterizerKernels
@@ -0,0 +1,74 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include <emmintrin.h>
+
+#include "RasterizerKernel.h"
+
+namespace lepong::RasterizerKernels
+{
+
+// Only ever compiled for SSE2, see MatchBatchSSE2.cpp.
+namespace
+{
+
+///
+/// Shades 4 pixels of a row from <i>column</i> on, the same way ShadeBall does.
+///
+void ShadeBall4(const Geometry& geometry, int column, float dy, float ballX, std::uint8_t* line) noexcept
+{
+    const auto kColumns = _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(column), _mm_setr_epi32(0, 1, 2, 3)));
+    const auto kCenters = _mm_mul_ps(_mm_add_ps(kColumns, _mm_set1_ps(0.5f)), _mm_set1_ps(geometry.pixelWidth));
+
+    const auto kU = _mm_mul_ps(_mm_sub_ps(kCenters, _mm_set1_ps(ballX)), _mm_set1_ps(geometry.inverseBallRadius));
+    const auto kV = _mm_set1_ps(dy * geometry.inverseBallRadius);
+    const auto kSquareDistance = _mm_add_ps(_mm_mul_ps(kU, kU), _mm_mul_ps(kV, kV));
+    const auto kCube = _mm_mul_ps(_mm_mul_ps(kSquareDistance, kSquareDistance), kSquareDistance);
+
+    auto intensity = _mm_sub_ps(_mm_set1_ps(1.0f), kCube);
+    intensity = _mm_min_ps(_mm_max_ps(intensity, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+
+    const auto kValues = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(intensity, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+    const auto kBytes = _mm_packus_epi16(_mm_packs_epi32(kValues, kValues), kValues);
+
+    const auto kPacked = _mm_cvtsi128_si32(kBytes);
+    std::memcpy(line + column, &kPacked, 4);
+}
+
+} // namespace
+
+void DrawSSE2(const MatchBatch& batch, const Geometry& geometry, std::size_t begin, std::size_t end, std::uint8_t* frames) noexcept
+{
+    constexpr auto kLastGroup = static_cast<int>(Rasterizer::skFrameWidth) - 4;
+
+    for (auto i = begin; i < end; ++i)
+    {
+        auto* frame = frames + (i - begin) * Rasterizer::skFrameSize;
+        std::memset(frame, 0, Rasterizer::skFrameSize);
+
+        const auto kScene = GetScene(batch, geometry, i);
+        const auto& kBall = kScene.ball;
+
+        for (auto row = kBall.firstRow; row < kBall.endRow; ++row)
+        {
+            auto* line = frame + row * Rasterizer::skFrameWidth;
+            const auto kDy = GetRowCenter(geometry, static_cast<float>(row)) - kScene.ballY;
+
+            // Pixels next to the quad shade to 0 like the clear background under them, so groups can start early to
+            // stay inside the row.
+            for (auto column = kBall.firstColumn; column < kBall.endColumn; column += 4)
+            {
+                ShadeBall4(geometry, std::min(column, kLastGroup), kDy, kScene.ballX, line);
+            }
+        }
+
+        DrawPaddles(kScene, frame);
+    }
+}
+
+} // namespace lepong::RasterizerKernels
@@ -0,0 +1,298 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+#include <cstring>
+
+#include "lepong/Check.h"
+#include "lepong/Game/Bot.h"
+#include "lepong/Sim/Replay.h"
+#include "lepong/Sim/Snapshot.h"
+
+namespace lepong
+{
+
+static constexpr std::uint8_t skMagic[] = { 'L', 'P', 'R', 'P' };
+static constexpr std::uint8_t skVersion = 1;
+
+static constexpr std::uint8_t skContinuousFlag = 1u;
+static constexpr unsigned skBotShift = 1u;
+
+static constexpr std::size_t skHeaderSize = sizeof(skMagic) + 2 + 8 + 4;
+
+// Action 3 isn't a paddle action, it marks the special events.
+static constexpr unsigned skSpecialAction = 3;
+static constexpr unsigned skLaunchPlayer = 0;
+static constexpr unsigned skEndPlayer = 1;
+
+// Most matches store a few ticks between inputs, so a reserve this size is rarely grown.
+static constexpr std::size_t skReserve = 512;
+
+static void WriteBytes(Replay& replay, std::uint64_t value, unsigned count) noexcept
+{
+    for (auto i = 0u; i < count; ++i)
+    {
+        replay.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+}
+
+static void WriteVarint(Replay& replay, std::uint64_t value) noexcept
+{
+    while (value >= 0x80u)
+    {
+        replay.push_back(static_cast<std::uint8_t>(value | 0x80u));
+        value >>= 7u;
+    }
+
+    replay.push_back(static_cast<std::uint8_t>(value));
+}
+
+///
+/// Reads a replay from the front, every read fails once the end is passed.
+///
+class ReplayReader
+{
+public:
+    explicit ReplayReader(const Replay& replay) noexcept
+        : mData(replay.data())
+        , mSize(replay.size())
+    {
+    }
+
+public:
+    bool Skip(std::size_t count) noexcept
+    {
+        LEPONG_CHECK_OR_RETURN_VAL(mSize - mOffset >= count, false);
+
+        mOffset += count;
+        return true;
+    }
+
+    bool ReadBytes(std::uint64_t& value, unsigned count) noexcept
+    {
+        LEPONG_CHECK_OR_RETURN_VAL(mSize - mOffset >= count, false);
+
+        value = 0;
+
+        for (auto i = 0u; i < count; ++i)
+        {
+            value |= static_cast<std::uint64_t>(mData[mOffset++]) << (8 * i);
+        }
+
+        return true;
+    }
+
+    bool ReadVarint(std::uint64_t& value) noexcept
+    {
+        value = 0;
+
+        for (auto shift = 0u; shift < 64u; shift += 7u)
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(mOffset < mSize, false);
+
+            const auto kByte = mData[mOffset++];
+            value |= static_cast<std::uint64_t>(kByte & 0x7Fu) << shift;
+
+            if (!(kByte & 0x80u))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    LEPONG_NODISCARD bool AtEnd() const noexcept
+    {
+        return mOffset == mSize;
+    }
+
+private:
+    const std::uint8_t* mData;
+    std::size_t mSize;
+    std::size_t mOffset = 0;
+};
+
+void ReplayRecorder::Begin(const Match& match, float delta, Replay& replay, unsigned bots) noexcept
+{
+    mReplay = &replay;
+    mBots = bots & 3u;
+    mTick = 0;
+    mLastEventTick = 0;
+    mActions[0] = PaddleAction::Stay;
+    mActions[1] = PaddleAction::Stay;
+
+    replay.clear();
+    replay.reserve(skReserve);
+
+    replay.insert(replay.end(), skMagic, skMagic + sizeof(skMagic));
+    replay.push_back(skVersion);
+    replay.push_back(static_cast<std::uint8_t>((match.continuousCollision ? skContinuousFlag : 0u) | (mBots << skBotShift)));
+
+    std::uint32_t deltaBits;
+    std::memcpy(&deltaBits, &delta, sizeof(float));
+
+    WriteBytes(replay, match.random.state, 8);
+    WriteBytes(replay, deltaBits, 4);
+}
+
+void ReplayRecorder::Launch() noexcept
+{
+    WriteEvent(skLaunchPlayer, skSpecialAction);
+}
+
+void ReplayRecorder::Tick(const PaddleAction (&actions)[2]) noexcept
+{
+    for (auto player = 0u; player < 2u; ++player)
+    {
+        if (!(mBots & (1u << player)) && actions[player] != mActions[player])
+        {
+            mActions[player] = actions[player];
+            WriteEvent(player, static_cast<unsigned>(actions[player]));
+        }
+    }
+
+    ++mTick;
+}
+
+void ReplayRecorder::End(const Match& match) noexcept
+{
+    WriteEvent(skEndPlayer, skSpecialAction);
+    WriteBytes(*mReplay, HashState(match), 8);
+}
+
+void ReplayRecorder::WriteEvent(unsigned player, unsigned action) noexcept
+{
+    WriteVarint(*mReplay, ((mTick - mLastEventTick) << 3u) | (player << 2u) | action);
+    mLastEventTick = mTick;
+}
+
+ReplayStatus PlayReplay(const Replay& replay, Match& match, ReplayInfo* info) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(replay.size() >= skHeaderSize, ReplayStatus::Malformed);
+    LEPONG_CHECK_OR_RETURN_VAL(!std::memcmp(replay.data(), skMagic, sizeof(skMagic)), ReplayStatus::Malformed);
+    LEPONG_CHECK_OR_RETURN_VAL(replay[4] == skVersion, ReplayStatus::Malformed);
+
+    ReplayReader reader(replay);
+
+    // The magic, the version and the flags were checked above.
+    reader.Skip(6);
+
+    std::uint64_t randomState;
+    std::uint64_t deltaBits;
+    reader.ReadBytes(randomState, 8);
+    reader.ReadBytes(deltaBits, 4);
+
+    const auto kDeltaBits = static_cast<std::uint32_t>(deltaBits);
+
+    float delta;
+    std::memcpy(&delta, &kDeltaBits, sizeof(float));
+
+    match = Match();
+    match.random.state = randomState;
+    match.continuousCollision = replay[5] & skContinuousFlag;
+
+    const auto kBots = static_cast<unsigned>(replay[5] >> skBotShift) & 3u;
+
+    PaddleAction actions[2] = { PaddleAction::Stay, PaddleAction::Stay };
+
+    std::uint64_t tick = 0;
+    std::uint64_t events = 0;
+
+    for (;;)
+    {
+        std::uint64_t event;
+        LEPONG_CHECK_OR_RETURN_VAL(reader.ReadVarint(event), ReplayStatus::Malformed);
+
+        ++events;
+
+        // Simulate the ticks up to the one this event is keyed by.
+        for (auto ticks = event >> 3u; ticks; --ticks, ++tick)
+        {
+            for (auto player = 0u; player < 2u; ++player)
+            {
+                if (kBots & (1u << player))
+                {
+                    actions[player] = TrackBall(match.GetPaddle(player), match.ball);
+                }
+            }
+
+            match.paddle1.ApplyAction(actions[0]);
+            match.paddle2.ApplyAction(actions[1]);
+            match.Update(delta);
+        }
+
+        const auto kPlayer = static_cast<unsigned>(event >> 2u) & 1u;
+        const auto kAction = static_cast<unsigned>(event) & 3u;
+
+        if (kAction != skSpecialAction)
+        {
+            actions[kPlayer] = static_cast<PaddleAction>(kAction);
+        }
+        else if (kPlayer == skLaunchPlayer)
+        {
+            match.Launch();
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    std::uint64_t expectedHash;
+    LEPONG_CHECK_OR_RETURN_VAL(reader.ReadBytes(expectedHash, 8) && reader.AtEnd(), ReplayStatus::Malformed);
+
+    const auto kHash = HashState(match);
+
+    if (info)
+    {
+        info->ticks = tick;
+        info->events = events;
+        info->hash = kHash;
+    }
+
+    return kHash == expectedHash ? ReplayStatus::Ok : ReplayStatus::Desync;
+}
+
+bool SaveReplay(const Replay& replay, const char* path) noexcept
+{
+    auto* file = std::fopen(path, "wb");
+    LEPONG_CHECK_OR_RETURN_VAL(file, false);
+
+    const auto kWritten = std::fwrite(replay.data(), 1, replay.size(), file) == replay.size();
+    return (std::fclose(file) == 0) && kWritten;
+}
+
+bool LoadReplay(const char* path, Replay& replay) noexcept
+{
+    auto* file = std::fopen(path, "rb");
+    LEPONG_CHECK_OR_RETURN_VAL(file, false);
+
+    replay.clear();
+
+    std::uint8_t buffer[4096];
+    std::size_t read;
+
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        replay.insert(replay.end(), buffer, buffer + read);
+    }
+
+    const auto kFailed = std::ferror(file) != 0;
+    std::fclose(file);
+
+    return !kFailed;
+}
+
+PaddleAction GetPaddleAction(const Paddle& paddle) noexcept
+{
+    if (paddle.moveSpeed == 0.0f || paddle.moveDirection.y == 0.0f)
+    {
+        return PaddleAction::Stay;
+    }
+
+    return paddle.moveDirection.y > 0.0f ? PaddleAction::Up : PaddleAction::Down;
+}
+
+} // namespace lepong
@@ -0,0 +1,349 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Check.h"
+
+#include "lepong/Sim/ScalarMatch.h"
+
+namespace lepong
+{
+
+namespace
+{
+
+///
+/// The operations that can't be written the same way for every scalar.
+///
+template<typename Scalar>
+struct ScalarPolicy;
+
+template<>
+struct ScalarPolicy<float>
+{
+    LEPONG_NODISCARD static constexpr float FromFloat(float value) noexcept
+    {
+        return value;
+    }
+
+    LEPONG_NODISCARD static constexpr float ToFloat(float value) noexcept
+    {
+        return value;
+    }
+
+    ///
+    /// Computed like <i>Vector2::Mag</i>.
+    ///
+    LEPONG_NODISCARD static float Magnitude(float x, float y) noexcept
+    {
+        return sqrtf((x * x) + (y * y));
+    }
+
+    ///
+    /// Computed like <i>Ball::DoCollideWith</i>.
+    ///
+    LEPONG_NODISCARD static constexpr bool IsWithin(float distance, float range) noexcept
+    {
+        return (distance * distance) < (range * range);
+    }
+};
+
+template<>
+struct ScalarPolicy<Fixed>
+{
+    LEPONG_NODISCARD static constexpr Fixed FromFloat(float value) noexcept
+    {
+        return Fixed(value);
+    }
+
+    LEPONG_NODISCARD static constexpr float ToFloat(Fixed value) noexcept
+    {
+        return static_cast<float>(value);
+    }
+
+    LEPONG_NODISCARD static Fixed Magnitude(Fixed x, Fixed y) noexcept
+    {
+        return Hypot(x, y);
+    }
+
+    ///
+    /// Squaring the distance would overflow across the arena, comparing the absolute value is the same test.
+    ///
+    LEPONG_NODISCARD static constexpr bool IsWithin(Fixed distance, Fixed range) noexcept
+    {
+        return Abs(distance) < range;
+    }
+};
+
+///
+/// The constants of Ball.cpp, Paddle.cpp and Match.cpp converted once to the scalar.
+///
+template<typename Scalar>
+struct Constants
+{
+    using Policy = ScalarPolicy<Scalar>;
+
+    static constexpr auto skArenaWidth = Policy::FromFloat(static_cast<float>(Match::skArenaSize.x));
+    static constexpr auto skArenaHeight = Policy::FromFloat(static_cast<float>(Match::skArenaSize.y));
+
+    static constexpr auto skRadius = Policy::FromFloat(Match::skBallRadius);
+    static constexpr auto skQuarterRadius = Policy::FromFloat(Match::skBallRadius * 0.25f);
+
+    static constexpr auto skPaddleHalfWidth = Policy::FromFloat(Match::skPaddleSize.x / 2.0f);
+    static constexpr auto skPaddleHalfHeight = Policy::FromFloat(Match::skPaddleSize.y / 2.0f);
+
+    // Paddle::CollideWithTerrain.
+    static constexpr auto skPaddleMinTerrainOffset = Policy::FromFloat(Match::skPaddleSize.y * 0.1f);
+    static constexpr auto skPaddleTopLimit = Policy::FromFloat(Match::skArenaSize.y - Match::skPaddleSize.y / 2.0f);
+
+    // Ball::DoCollideWith.
+    static constexpr auto skPaddleGraceZone = Policy::FromFloat(Match::skPaddleSize.y * 0.1f);
+
+    static constexpr auto skBallMoveSpeed = Policy::FromFloat(Ball::skDefaultMoveSpeed);
+    static constexpr auto skPaddleMoveSpeed = Policy::FromFloat(Paddle::skDefaultMoveSpeed);
+    static constexpr auto skPaddleHitSpeedGain = Policy::FromFloat(50.0f);
+
+    static constexpr Scalar skPaddleX[2] =
+    {
+        Policy::FromFloat(Match::skPaddleBorderOffset),
+        Policy::FromFloat(Match::skArenaSize.x - Match::skPaddleBorderOffset)
+    };
+
+    static constexpr int skPaddleForward[2] = { 1, -1 };
+};
+
+} // namespace
+
+template<typename Scalar>
+ScalarMatch<Scalar>::ScalarMatch() noexcept
+{
+    Load(Match{});
+}
+
+template<typename Scalar>
+void ScalarMatch<Scalar>::Load(const Match& match) noexcept
+{
+    using Policy = ScalarPolicy<Scalar>;
+
+    ballPosition = { Policy::FromFloat(match.ball.position.x), Policy::FromFloat(match.ball.position.y) };
+    ballDirection = { Policy::FromFloat(match.ball.moveDirection.x), Policy::FromFloat(match.ball.moveDirection.y) };
+    ballSpeed = Policy::FromFloat(match.ball.moveSpeed);
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        const auto& kPaddle = match.GetPaddle(p);
+
+        paddleY[p] = Policy::FromFloat(kPaddle.position.y);
+        paddleDirection[p] = Policy::FromFloat(kPaddle.moveDirection.y);
+        paddleSpeed[p] = Policy::FromFloat(kPaddle.moveSpeed);
+
+        scores[p] = match.scores[p];
+    }
+
+    playing = match.playing;
+    random = match.random;
+}
+
+template<typename Scalar>
+void ScalarMatch<Scalar>::Store(Match& match) const noexcept
+{
+    using Policy = ScalarPolicy<Scalar>;
+
+    match.ball.position = { Policy::ToFloat(ballPosition.x), Policy::ToFloat(ballPosition.y) };
+    match.ball.moveDirection = { Policy::ToFloat(ballDirection.x), Policy::ToFloat(ballDirection.y) };
+    match.ball.moveSpeed = Policy::ToFloat(ballSpeed);
+
+    for (auto p = 0u; p < 2u; ++p)
+    {
+        auto& paddle = match.GetPaddle(p);
+
+        paddle.position.y = Policy::ToFloat(paddleY[p]);
+        paddle.moveDirection = { 0.0f, Policy::ToFloat(paddleDirection[p]) };
+        paddle.moveSpeed = Policy::ToFloat(paddleSpeed[p]);
+
+        match.scores[p] = scores[p];
+    }
+
+    match.playing = playing;
+    match.random = random;
+    match.Rehash();
+}
+
+template<typename Scalar>
+void ScalarMatch<Scalar>::Reset() noexcept
+{
+    using C = Constants<Scalar>;
+
+    const Vector kCenter = { C::skArenaWidth / 2, C::skArenaHeight / 2 };
+
+    ballPosition = kCenter;
+    ballDirection = {};
+    ballSpeed = 0;
+
+    for (auto p = 0; p < 2; ++p)
+    {
+        paddleY[p] = kCenter.y;
+        paddleDirection[p] = 0;
+        paddleSpeed[p] = 0;
+    }
+
+    playing = false;
+}
+
+template<typename Scalar>
+void ScalarMatch<Scalar>::Launch() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(!playing);
+
+    playing = true;
+
+    ballSpeed = Constants<Scalar>::skBallMoveSpeed;
+
+    // Normalize, written with the policy so that the fixed point path stays on integers.
+    const Vector kDirection = { Scalar(random.NextSign()), Scalar(random.NextSign()) };
+    const auto kMag = ScalarPolicy<Scalar>::Magnitude(kDirection.x, kDirection.y);
+
+    ballDirection = kDirection / kMag;
+}
+
+template<typename Scalar>
+Side ScalarMatch<Scalar>::Update(Scalar delta, const PaddleAction (&actions)[2]) noexcept
+{
+    using Policy = ScalarPolicy<Scalar>;
+    using C = Constants<Scalar>;
+
+    // Paddle::ApplyAction.
+    for (auto p = 0; p < 2; ++p)
+    {
+        switch (actions[p])
+        {
+        case PaddleAction::Up:
+            paddleSpeed[p] = C::skPaddleMoveSpeed;
+            paddleDirection[p] = 1;
+            break;
+
+        case PaddleAction::Down:
+            paddleSpeed[p] = C::skPaddleMoveSpeed;
+            paddleDirection[p] = -1;
+            break;
+
+        default:
+            // Releasing only stops a paddle that is moving.
+            if (paddleDirection[p] != 0)
+            {
+                paddleSpeed[p] = 0;
+                paddleDirection[p] = 0;
+            }
+            break;
+        }
+    }
+
+    // GameObject::Update for the ball.
+    ballPosition += ballDirection * ballSpeed * delta;
+
+    // Paddle::Update then Paddle::CollideWithTerrain.
+    for (auto p = 0; p < 2; ++p)
+    {
+        const auto kPreUpdateY = paddleY[p];
+        paddleY[p] += paddleDirection[p] * paddleSpeed[p] * delta;
+
+        const auto kCollidesTop = paddleY[p] + C::skPaddleMinTerrainOffset > C::skPaddleTopLimit;
+        const auto kCollidesBottom = paddleY[p] - C::skPaddleMinTerrainOffset < C::skPaddleHalfHeight;
+
+        if (kCollidesTop || kCollidesBottom)
+        {
+            paddleY[p] = kPreUpdateY;
+        }
+    }
+
+    // Ball::CollideWithTerrain.
+    const auto kCollidesTop = ballPosition.y > C::skArenaHeight - C::skRadius && ballDirection.y > 0;
+    const auto kCollidesBottom = ballPosition.y < C::skRadius && ballDirection.y < 0;
+
+    if (kCollidesTop || kCollidesBottom)
+    {
+        ballDirection.y = -ballDirection.y;
+    }
+
+    // Ball::CollideWith, the second paddle is only checked if the first one didn't collide.
+    auto collides = false;
+
+    for (auto p = 0; p < 2 && !collides; ++p)
+    {
+        const auto kForward = C::skPaddleForward[p];
+
+        const auto kMovingToward = kForward > 0 ? ballDirection.x < 0 : ballDirection.x > 0;
+
+        const auto kFrontEdge = kForward > 0
+            ? C::skPaddleX[p] + C::skPaddleHalfWidth
+            : C::skPaddleX[p] - C::skPaddleHalfWidth;
+
+        const auto kBehind = kForward > 0
+            ? ballPosition.x - C::skQuarterRadius < kFrontEdge
+            : ballPosition.x + C::skQuarterRadius > kFrontEdge;
+
+        const auto kInRangeY =
+            ballPosition.y < paddleY[p] + C::skPaddleHalfHeight + C::skPaddleGraceZone &&
+            ballPosition.y > paddleY[p] - C::skPaddleHalfHeight - C::skPaddleGraceZone;
+
+        const auto kTouching = Policy::IsWithin(ballPosition.x - kFrontEdge, C::skRadius);
+
+        if (kMovingToward && !kBehind && kInRangeY && kTouching)
+        {
+            // Ball::OnPaddleCollision.
+            const Vector kAway = { ballPosition.x - C::skPaddleX[p], ballPosition.y - paddleY[p] };
+
+            ballSpeed += C::skPaddleHitSpeedGain;
+            ballDirection = kAway / Policy::Magnitude(kAway.x, kAway.y);
+
+            collides = true;
+        }
+    }
+
+    if (collides)
+    {
+        return Side::None;
+    }
+
+    // Ball::GetTouchingSide then the score update and reset from Match.
+    auto lostSide = Side::None;
+
+    if (ballPosition.x < C::skRadius)
+    {
+        lostSide = Side::Player1;
+    }
+    else if (ballPosition.x > C::skArenaWidth - C::skRadius)
+    {
+        lostSide = Side::Player2;
+    }
+
+    if (lostSide != Side::None)
+    {
+        ++scores[1 - static_cast<int>(lostSide)];
+        Reset();
+    }
+
+    return lostSide;
+}
+
+template<typename Scalar>
+PaddleAction ScalarMatch<Scalar>::TrackBall(unsigned player, Scalar deadZone) const noexcept
+{
+    const auto kOffset = ballPosition.y - paddleY[player];
+
+    if (kOffset > deadZone)
+    {
+        return PaddleAction::Up;
+    }
+    else if (kOffset < -deadZone)
+    {
+        return PaddleAction::Down;
+    }
+
+    return PaddleAction::Stay;
+}
+
+template class ScalarMatch<float>;
+template class ScalarMatch<Fixed>;
+
+} // namespace lepong
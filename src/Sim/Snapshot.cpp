@@ -0,0 +1,72 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Sim/Snapshot.h"
+
+namespace lepong
+{
+
+static constexpr std::uint64_t skFnvOffset = 0xCBF29CE484222325ull;
+static constexpr std::uint64_t skFnvPrime = 0x100000001B3ull;
+
+template<typename T>
+static void HashValue(std::uint64_t& hash, const T& value) noexcept
+{
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+
+    for (const auto kByte : bytes)
+    {
+        hash = (hash ^ kByte) * skFnvPrime;
+    }
+}
+
+static void HashObject(std::uint64_t& hash, const GameObject& object) noexcept
+{
+    HashValue(hash, object.position.x);
+    HashValue(hash, object.position.y);
+    HashValue(hash, object.moveSpeed);
+    HashValue(hash, object.moveDirection.x);
+    HashValue(hash, object.moveDirection.y);
+}
+
+std::uint64_t HashState(const Match& match) noexcept
+{
+    auto hash = skFnvOffset;
+
+    HashObject(hash, match.ball);
+    HashObject(hash, match.paddle1);
+    HashObject(hash, match.paddle2);
+
+    HashValue(hash, match.scores[0]);
+    HashValue(hash, match.scores[1]);
+    HashValue(hash, match.playing);
+    HashValue(hash, match.random.state);
+    HashValue(hash, match.continuousCollision);
+
+    return hash;
+}
+
+SnapshotRing::SnapshotRing(std::size_t capacity) noexcept
+{
+    std::size_t size = 1;
+
+    while (size < capacity)
+    {
+        size <<= 1u;
+    }
+
+    mStates.resize(size);
+    mMask = size - 1;
+}
+
+void SnapshotRing::Clear() noexcept
+{
+    for (auto& state : mStates)
+    {
+        state.tick = GameState::skNoTick;
+    }
+}
+
+} // namespace lepong
@@ -0,0 +1,269 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+#include "lepong/Check.h"
+#include "lepong/Sim/Timeline.h"
+
+namespace lepong
+{
+
+static constexpr char skMagic[] = { 'L', 'P', 'T', 'L' };
+static constexpr char skIndexMagic[] = { 'L', 'P', 'T', 'I' };
+static constexpr std::uint8_t skVersion = 1;
+
+static constexpr std::size_t skHeaderSize = 20;
+static constexpr std::size_t skFooterSize = 3 * sizeof(std::uint64_t) + sizeof(skIndexMagic);
+
+static constexpr unsigned skActionBits = 2;
+static constexpr std::uint8_t skActionMask = 3u;
+static constexpr std::uint8_t skLaunchBit = 1u << 4u;
+
+template<typename T>
+LEPONG_NODISCARD static T Load(const std::uint8_t* data) noexcept
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+
+    return value;
+}
+
+TimelineWriter::~TimelineWriter() noexcept
+{
+    Close();
+}
+
+bool TimelineWriter::Open(const char* path, float delta, unsigned keyframeInterval) noexcept
+{
+    Close();
+
+    LEPONG_CHECK_OR_RETURN_VAL(keyframeInterval, false);
+
+    mFile = std::fopen(path, "wb");
+    LEPONG_CHECK_OR_RETURN_VAL(mFile, false);
+
+    mFailed = false;
+    mKeyframeInterval = keyframeInterval;
+    mTicks = 0;
+    mOffset = 0;
+    mIndex.clear();
+
+    const std::uint8_t kVersion[] = { skVersion, 0u, 0u, 0u };
+    const std::uint32_t kMatchSize = sizeof(Match);
+
+    Write(skMagic, sizeof(skMagic));
+    Write(kVersion, sizeof(kVersion));
+    Write(&kMatchSize, sizeof(kMatchSize));
+    Write(&mKeyframeInterval, sizeof(std::uint32_t));
+    Write(&delta, sizeof(delta));
+
+    return !mFailed;
+}
+
+void TimelineWriter::Record(const Match& match, bool launched, const PaddleAction (&actions)[2]) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mFile);
+
+    if (mTicks % mKeyframeInterval == 0)
+    {
+        // The contact buffer belongs to this process, the file mustn't keep its address.
+        auto keyframe = match;
+        keyframe.contacts = nullptr;
+
+        mIndex.push_back(mOffset);
+        Write(&keyframe, sizeof(Match));
+    }
+
+    const auto kDelta = static_cast<std::uint8_t>(
+        static_cast<unsigned>(actions[0]) |
+        (static_cast<unsigned>(actions[1]) << skActionBits) |
+        (launched ? skLaunchBit : 0u));
+
+    Write(&kDelta, sizeof(kDelta));
+    ++mTicks;
+}
+
+bool TimelineWriter::Close() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(mFile, false);
+
+    const std::uint64_t kIndexOffset = mOffset;
+    const std::uint64_t kKeyframes = mIndex.size();
+
+    Write(mIndex.data(), mIndex.size() * sizeof(std::uint64_t));
+    Write(&kKeyframes, sizeof(kKeyframes));
+    Write(&mTicks, sizeof(mTicks));
+    Write(&kIndexOffset, sizeof(kIndexOffset));
+    Write(skIndexMagic, sizeof(skIndexMagic));
+
+    mFailed |= std::fclose(mFile) != 0;
+    mFile = nullptr;
+
+    return !mFailed;
+}
+
+void TimelineWriter::Write(const void* data, std::size_t size) noexcept
+{
+    mFailed |= std::fwrite(data, 1, size, mFile) != size;
+    mOffset += size;
+}
+
+TimelineReader::~TimelineReader() noexcept
+{
+    Close();
+}
+
+bool TimelineReader::Open(const char* path) noexcept
+{
+    Close();
+
+#if defined(_WIN32)
+    const auto kFile = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    LEPONG_CHECK_OR_RETURN_VAL(kFile != INVALID_HANDLE_VALUE, false);
+
+    LARGE_INTEGER size;
+    const auto kHasSize = GetFileSizeEx(kFile, &size) && size.QuadPart > 0;
+
+    // The mapping keeps the file open.
+    mMapping = kHasSize ? CreateFileMappingA(kFile, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    CloseHandle(kFile);
+
+    LEPONG_CHECK_OR_RETURN_VAL(mMapping, false);
+
+    mData = static_cast<const std::uint8_t*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+    mSize = static_cast<std::size_t>(size.QuadPart);
+
+    if (!mData)
+    {
+        Close();
+        return false;
+    }
+#else
+    const auto kFile = open(path, O_RDONLY);
+    LEPONG_CHECK_OR_RETURN_VAL(kFile >= 0, false);
+
+    struct stat status = {};
+    const auto kHasSize = fstat(kFile, &status) == 0 && status.st_size > 0;
+
+    auto* data = kHasSize ? mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, kFile, 0) : MAP_FAILED;
+
+    // The mapping keeps the file open.
+    close(kFile);
+
+    LEPONG_CHECK_OR_RETURN_VAL(data != MAP_FAILED, false);
+
+    mData = static_cast<const std::uint8_t*>(data);
+    mSize = static_cast<std::size_t>(status.st_size);
+#endif
+
+    const auto kValid =
+        mSize >= skHeaderSize + skFooterSize &&
+        !std::memcmp(mData, skMagic, sizeof(skMagic)) &&
+        mData[4] == skVersion &&
+        Load<std::uint32_t>(mData + 8) == sizeof(Match) &&
+        !std::memcmp(mData + mSize - sizeof(skIndexMagic), skIndexMagic, sizeof(skIndexMagic));
+
+    if (kValid)
+    {
+        const auto* footer = mData + mSize - skFooterSize;
+
+        mKeyframeInterval = Load<std::uint32_t>(mData + 12);
+        mDelta = Load<float>(mData + 16);
+        mKeyframes = Load<std::uint64_t>(footer);
+        mTicks = Load<std::uint64_t>(footer + 8);
+
+        const auto kIndexOffset = Load<std::uint64_t>(footer + 16);
+        mIndex = mData + kIndexOffset;
+
+        // Every keyframe chunk must fit before the index.
+        const auto kIndexFits =
+            kIndexOffset >= skHeaderSize && kIndexOffset + mKeyframes * sizeof(std::uint64_t) + skFooterSize == mSize;
+        const auto kTicksFit = mKeyframeInterval && (mTicks + mKeyframeInterval - 1) / mKeyframeInterval == mKeyframes;
+
+        if (kIndexFits && kTicksFit)
+        {
+            return true;
+        }
+    }
+
+    Close();
+    return false;
+}
+
+void TimelineReader::Close() noexcept
+{
+    if (mData)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(mData);
+#else
+        munmap(const_cast<std::uint8_t*>(mData), mSize);
+#endif
+    }
+
+#if defined(_WIN32)
+    if (mMapping)
+    {
+        CloseHandle(mMapping);
+    }
+#endif
+
+    mData = nullptr;
+    mSize = 0;
+    mMapping = nullptr;
+    mIndex = nullptr;
+    mTicks = 0;
+    mKeyframes = 0;
+}
+
+bool TimelineReader::Seek(std::uint64_t tick, Match& match) const noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(tick < mTicks, false);
+
+    const auto kKeyframe = tick / mKeyframeInterval;
+    const auto kOffset = Load<std::uint64_t>(mIndex + kKeyframe * sizeof(std::uint64_t));
+
+    const auto kTicks = static_cast<std::size_t>(tick - kKeyframe * mKeyframeInterval);
+
+    // The offset comes from the file, don't trust it.
+    LEPONG_CHECK_OR_RETURN_VAL(kOffset >= skHeaderSize && kOffset + sizeof(Match) + kTicks < static_cast<std::uint64_t>(mIndex - mData), false);
+
+    const auto* chunk = mData + kOffset;
+    const auto* deltas = chunk + sizeof(Match);
+
+    // Keyframes have no contact buffer. The caller's one is given back once at the requested tick, so it doesn't get the
+    // contacts of the ticks simulated to reach it.
+    const auto kContacts = match.contacts;
+
+    std::memcpy(&match, chunk, sizeof(Match));
+    match.contacts = nullptr;
+
+    // The keyframe is the start of its first tick, simulate the ones before the requested tick.
+    for (std::size_t i = 0; i < kTicks; ++i)
+    {
+        match.paddle1.ApplyAction(static_cast<PaddleAction>(deltas[i] & skActionMask));
+        match.paddle2.ApplyAction(static_cast<PaddleAction>((deltas[i] >> skActionBits) & skActionMask));
+        match.Update(mDelta);
+
+        if (deltas[i + 1] & skLaunchBit)
+        {
+            match.Launch();
+        }
+    }
+
+    match.contacts = kContacts;
+    return true;
+}
+
+} // namespace lepong
@@ -0,0 +1,416 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#include "lepong/Check.h"
+#include "lepong/Sim/Tournament.h"
+#include "lepong/Sim/TrajectoryPredictor.h"
+
+// Results file layout, little endian:
+//
+// header   "LPTN", u8 version, u8 pairing, u16 games per pair, u32 players, u32 pairs, u64 matches, u64 ticks
+// player   u8 name length, name, f32 elo, f32 mu, f32 sigma
+// pair     u16 first player, u16 second player, u32 games, u32 wins x2, u32 points x2, u64 ticks
+
+namespace lepong
+{
+
+static constexpr std::uint8_t skMagic[] = { 'L', 'P', 'T', 'N' };
+static constexpr std::uint8_t skVersion = 1;
+
+static constexpr auto skArenaHeight = static_cast<float>(Match::skArenaSize.y);
+
+// TrueSkill's defaults: the performance spread of a match and how much skills drift between matches.
+static constexpr double skBeta = 25.0 / 6.0;
+static constexpr double skTau = 25.0 / 300.0;
+
+static constexpr auto skNoPair = std::numeric_limits<std::size_t>::max();
+
+PaddleAction PlayBotStyle(const Match& match, unsigned player, void* userData) noexcept
+{
+    const auto& kStyle = *static_cast<const BotStyle*>(userData);
+
+    const auto& kBall = match.ball;
+    const auto& kPaddle = match.GetPaddle(player);
+
+    auto targetY = kBall.position.y;
+
+    if (kStyle.predict)
+    {
+        const auto kVelocity = kBall.moveDirection * kBall.moveSpeed;
+        const auto kPlane = kPaddle.position.x + (kPaddle.size.x / 2.0f + kBall.radius) * kPaddle.forward;
+
+        Intercept intercept;
+        const auto kIncoming = (kVelocity.x * kPaddle.forward) < 0.0f &&
+            PredictIntercept(kBall.position, kVelocity, kPlane, kBall.radius, skArenaHeight - kBall.radius, intercept);
+
+        targetY = kIncoming ? intercept.y : skArenaHeight / 2.0f;
+    }
+
+    // Meeting the ball above the paddle center means the paddle center goes below it.
+    targetY -= kStyle.aim * kPaddle.size.y / 2.0f;
+
+    const auto kOffset = targetY - kPaddle.position.y;
+
+    if (kOffset > kStyle.deadZone)
+    {
+        return PaddleAction::Up;
+    }
+    else if (kOffset < -kStyle.deadZone)
+    {
+        return PaddleAction::Down;
+    }
+
+    return PaddleAction::Stay;
+}
+
+///
+/// The TrueSkill update of a two player match without a draw.
+///
+static void UpdateTrueSkill(Rating& winner, Rating& loser) noexcept
+{
+    const auto kWinnerVariance = winner.sigma * winner.sigma + skTau * skTau;
+    const auto kLoserVariance = loser.sigma * loser.sigma + skTau * skTau;
+
+    const auto kSquareC = 2.0 * skBeta * skBeta + kWinnerVariance + kLoserVariance;
+    const auto kC = std::sqrt(kSquareC);
+    const auto kT = (winner.mu - loser.mu) / kC;
+
+    // The mean and variance corrections of a truncated Gaussian. A very unlikely win has a vanishing cdf, where v
+    // tends to -t.
+    const auto kPdf = std::exp(-kT * kT / 2.0) / std::sqrt(2.0 * 3.14159265358979323846);
+    const auto kCdf = 0.5 * std::erfc(-kT / std::sqrt(2.0));
+    const auto kV = kCdf > 1e-300 ? kPdf / kCdf : -kT;
+    const auto kW = kV * (kV + kT);
+
+    winner.mu += kWinnerVariance / kC * kV;
+    loser.mu -= kLoserVariance / kC * kV;
+
+    winner.sigma = std::sqrt(kWinnerVariance * std::max(1.0 - kWinnerVariance / kSquareC * kW, 1e-4));
+    loser.sigma = std::sqrt(kLoserVariance * std::max(1.0 - kLoserVariance / kSquareC * kW, 1e-4));
+}
+
+void UpdateRatings(Rating& first, Rating& second, double score, double eloK) noexcept
+{
+    const auto kExpected = 1.0 / (1.0 + std::pow(10.0, (second.elo - first.elo) / 400.0));
+    const auto kChange = eloK * (score - kExpected);
+
+    first.elo += kChange;
+    second.elo -= kChange;
+
+    if (score > 0.5)
+    {
+        UpdateTrueSkill(first, second);
+    }
+    else if (score < 0.5)
+    {
+        UpdateTrueSkill(second, first);
+    }
+}
+
+Tournament::Tournament(const TournamentSettings& settings) noexcept
+    : mSettings(settings)
+    , mFarm(settings.farm)
+{
+}
+
+void Tournament::Run(const std::vector<TournamentPlayer>& players) noexcept
+{
+    const auto kCount = players.size();
+
+    mPlayers = &players;
+    mNames.clear();
+
+    for (const auto& kPlayer : players)
+    {
+        mNames.push_back(kPlayer.name);
+    }
+
+    mRatings.assign(kCount, Rating{});
+    mPairs.clear();
+    mMatches = 0;
+    mTicks = 0;
+
+    LEPONG_CHECK_OR_RETURN(kCount >= 2 && mSettings.games);
+
+    std::vector<std::size_t> round;
+
+    if (mSettings.pairing == TournamentSettings::Pairing::RoundRobin)
+    {
+        // The circle method: the first player stays, the others turn around it by one seat every round. An odd
+        // count gets an empty seat, whoever sits in front of it rests.
+        const auto kSeats = kCount + (kCount % 2);
+
+        std::vector<std::size_t> seats(kSeats);
+        std::iota(seats.begin(), seats.end(), 0);
+
+        for (std::size_t r = 0; r + 1 < kSeats; ++r)
+        {
+            round.clear();
+
+            for (std::size_t s = 0; s < kSeats / 2; ++s)
+            {
+                const auto kFirst = seats[s];
+                const auto kSecond = seats[kSeats - 1 - s];
+
+                if (kFirst < kCount && kSecond < kCount)
+                {
+                    round.push_back(mPairs.size());
+                    mPairs.push_back({ { static_cast<std::uint32_t>(kFirst), static_cast<std::uint32_t>(kSecond) } });
+                }
+            }
+
+            PlayRound(round);
+            std::rotate(seats.begin() + 1, seats.end() - 1, seats.end());
+        }
+    }
+    else
+    {
+        for (auto r = 0u; r < mSettings.rounds; ++r)
+        {
+            PlayRound(PairSwissRound());
+        }
+    }
+
+    mPlayers = nullptr;
+}
+
+std::vector<std::size_t> Tournament::PairSwissRound() noexcept
+{
+    const auto kCount = mRatings.size();
+
+    // Best first, ties broken by index so that the first round pairs 0 with 1, 2 with 3 and so on.
+    std::vector<std::size_t> order(kCount);
+    std::iota(order.begin(), order.end(), 0);
+
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b)
+    {
+        return mRatings[a].GetConservative() > mRatings[b].GetConservative();
+    });
+
+    std::vector<std::size_t> pairOf(kCount * kCount, skNoPair);
+
+    for (std::size_t p = 0; p < mPairs.size(); ++p)
+    {
+        const auto kFirst = mPairs[p].players[0];
+        const auto kSecond = mPairs[p].players[1];
+
+        pairOf[kFirst * kCount + kSecond] = p;
+        pairOf[kSecond * kCount + kFirst] = p;
+    }
+
+    std::vector<bool> paired(kCount, false);
+    std::vector<std::size_t> round;
+
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        const auto kPlayer = order[i];
+
+        if (paired[kPlayer])
+        {
+            continue;
+        }
+
+        // The closest rated player not met yet, or the closest one if every player left was met.
+        auto opponent = skNoPair;
+
+        for (auto j = i + 1; j < kCount; ++j)
+        {
+            const auto kCandidate = order[j];
+
+            if (paired[kCandidate])
+            {
+                continue;
+            }
+
+            if (opponent == skNoPair)
+            {
+                opponent = kCandidate;
+            }
+
+            if (pairOf[kPlayer * kCount + kCandidate] == skNoPair)
+            {
+                opponent = kCandidate;
+                break;
+            }
+        }
+
+        // The last player of an odd count rests.
+        if (opponent == skNoPair)
+        {
+            break;
+        }
+
+        paired[kPlayer] = true;
+        paired[opponent] = true;
+
+        auto pair = pairOf[kPlayer * kCount + opponent];
+
+        if (pair == skNoPair)
+        {
+            pair = mPairs.size();
+            mPairs.push_back({ { static_cast<std::uint32_t>(kPlayer), static_cast<std::uint32_t>(opponent) } });
+        }
+
+        round.push_back(pair);
+    }
+
+    return round;
+}
+
+void Tournament::PlayRound(const std::vector<std::size_t>& round) noexcept
+{
+    const auto kGames = static_cast<std::size_t>(mSettings.games);
+
+    mRoundPairs = round;
+    mRoundResults.assign(round.size() * kGames, MatchResult{});
+
+    mFarm.Run(mRoundResults.size(), &Tournament::PlayMatch, this, mRoundResults.data());
+
+    // In schedule order whatever order the matches finished in, Elo depends on it.
+    for (std::size_t i = 0; i < mRoundResults.size(); ++i)
+    {
+        const auto& kResult = mRoundResults[i];
+        auto& pair = mPairs[mRoundPairs[i / kGames]];
+
+        // The first player of the pair plays on the left in even games.
+        const auto kSwapped = (i % kGames) % 2u;
+
+        const auto kFirstPoints = kResult.scores[kSwapped];
+        const auto kSecondPoints = kResult.scores[1u - kSwapped];
+
+        ++pair.games;
+        pair.points[0] += kFirstPoints;
+        pair.points[1] += kSecondPoints;
+        pair.ticks += kResult.ticks;
+
+        auto score = 0.5;
+
+        if (kFirstPoints >= mSettings.points)
+        {
+            ++pair.wins[0];
+            score = 1.0;
+        }
+        else if (kSecondPoints >= mSettings.points)
+        {
+            ++pair.wins[1];
+            score = 0.0;
+        }
+
+        UpdateRatings(mRatings[pair.players[0]], mRatings[pair.players[1]], score, mSettings.eloK);
+        mTicks += kResult.ticks;
+    }
+
+    mMatches += mRoundResults.size();
+}
+
+void Tournament::PlayMatch(Match& match, std::size_t index, MatchResult& result, void* userData) noexcept
+{
+    const auto& kTournament = *static_cast<const Tournament*>(userData);
+    const auto& kSettings = kTournament.mSettings;
+    const auto kGames = static_cast<std::size_t>(kSettings.games);
+
+    const auto& kPair = kTournament.mPairs[kTournament.mRoundPairs[index / kGames]];
+    const auto kSwapped = (index % kGames) % 2u;
+
+    const auto& kLeft = (*kTournament.mPlayers)[kPair.players[kSwapped]];
+    const auto& kRight = (*kTournament.mPlayers)[kPair.players[1u - kSwapped]];
+
+    // The farm seeds from the index in the round, every round would replay the same launches.
+    match.random = Random(kSettings.farm.seed, kTournament.mMatches + index);
+
+    while (match.scores[0] < kSettings.points && match.scores[1] < kSettings.points && result.ticks < kSettings.maxTicks)
+    {
+        if (!match.playing)
+        {
+            match.Launch();
+        }
+
+        match.paddle1.ApplyAction(kLeft.function(match, 0u, kLeft.userData));
+        match.paddle2.ApplyAction(kRight.function(match, 1u, kRight.userData));
+
+        match.Update(kSettings.delta);
+        ++result.ticks;
+    }
+
+    result.scores[0] = match.scores[0];
+    result.scores[1] = match.scores[1];
+}
+
+///
+/// Appends the <i>count</i> low bytes of <i>value</i>.
+///
+static void WriteBytes(std::vector<std::uint8_t>& data, std::uint64_t value, unsigned count) noexcept
+{
+    for (auto i = 0u; i < count; ++i)
+    {
+        data.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+}
+
+static void WriteFloat(std::vector<std::uint8_t>& data, double value) noexcept
+{
+    const auto kValue = static_cast<float>(value);
+
+    std::uint32_t bits;
+    std::memcpy(&bits, &kValue, sizeof(bits));
+
+    WriteBytes(data, bits, 4);
+}
+
+bool Tournament::Save(const char* path) const noexcept
+{
+    // Player indices are stored on 16 bits.
+    LEPONG_CHECK_OR_RETURN_VAL(mRatings.size() <= 0xFFFFu && mSettings.games <= 0xFFFFu, false);
+
+    std::vector<std::uint8_t> data(std::begin(skMagic), std::end(skMagic));
+
+    WriteBytes(data, skVersion, 1);
+    WriteBytes(data, static_cast<std::uint64_t>(mSettings.pairing), 1);
+    WriteBytes(data, mSettings.games, 2);
+    WriteBytes(data, mRatings.size(), 4);
+    WriteBytes(data, mPairs.size(), 4);
+    WriteBytes(data, mMatches, 8);
+    WriteBytes(data, mTicks, 8);
+
+    for (std::size_t i = 0; i < mRatings.size(); ++i)
+    {
+        // The names are only there to be read by people, long ones are cut.
+        const auto& kName = mNames[i];
+        const auto kLength = std::min<std::size_t>(kName.size(), 0xFFu);
+
+        WriteBytes(data, kLength, 1);
+        data.insert(data.end(), kName.begin(), kName.begin() + static_cast<std::ptrdiff_t>(kLength));
+
+        WriteFloat(data, mRatings[i].elo);
+        WriteFloat(data, mRatings[i].mu);
+        WriteFloat(data, mRatings[i].sigma);
+    }
+
+    for (const auto& kPair : mPairs)
+    {
+        WriteBytes(data, kPair.players[0], 2);
+        WriteBytes(data, kPair.players[1], 2);
+        WriteBytes(data, kPair.games, 4);
+        WriteBytes(data, kPair.wins[0], 4);
+        WriteBytes(data, kPair.wins[1], 4);
+        WriteBytes(data, kPair.points[0], 4);
+        WriteBytes(data, kPair.points[1], 4);
+        WriteBytes(data, kPair.ticks, 8);
+    }
+
+    auto* file = std::fopen(path, "wb");
+    LEPONG_CHECK_OR_RETURN_VAL(file, false);
+
+    const auto kWritten = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    return (std::fclose(file) == 0) && kWritten;
+}
+
+} // namespace lepong
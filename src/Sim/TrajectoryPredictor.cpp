@@ -0,0 +1,97 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cmath>
+
+#include "lepong/Check.h"
+#include "lepong/Sim/TrajectoryPredictor.h"
+
+namespace lepong
+{
+
+bool PredictIntercept(
+    const Vector2f& position, const Vector2f& velocity, float planeX, float minY, float maxY, Intercept& intercept) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(velocity.x != 0.0f, false);
+
+    const auto kTime = (planeX - position.x) / velocity.x;
+    LEPONG_CHECK_OR_RETURN_VAL(kTime >= 0.0f, false);
+
+    // In the unfolded space the terrain repeats every 2 * range, mirrored every other time.
+    const auto kRange = maxY - minY;
+    const auto kUnfolded = position.y + velocity.y * kTime - minY;
+
+    auto folded = kUnfolded - std::floor(kUnfolded / (2.0f * kRange)) * 2.0f * kRange;
+    folded = folded > kRange ? 2.0f * kRange - folded : folded;
+
+    intercept.y = minY + folded;
+    intercept.time = kTime;
+
+    return true;
+}
+
+TrajectoryPredictor::TrajectoryPredictor(float minY, float maxY) noexcept
+    : mMinY(minY)
+    , mMaxY(maxY)
+{
+}
+
+TrajectoryPredictor::TrajectoryPredictor() noexcept
+    : TrajectoryPredictor(Match::skBallRadius, static_cast<float>(Match::skArenaSize.y) - Match::skBallRadius)
+{
+}
+
+void TrajectoryPredictor::Resize(std::size_t balls) noexcept
+{
+    mEntries.resize(balls);
+}
+
+void TrajectoryPredictor::Invalidate(std::size_t ball) noexcept
+{
+    mEntries[ball] = Entry{};
+}
+
+bool TrajectoryPredictor::PredictMiss(
+    Entry& entry, const Vector2f& position, const Vector2f& velocity, float planeX, Intercept& intercept) noexcept
+{
+    const auto kSpeedY = std::fabs(velocity.y);
+    const auto kBehind = velocity.x > 0.0f ? position.x < entry.lastX : position.x > entry.lastX;
+
+    if (entry.velocityX != velocity.x || entry.speedY != kSpeedY || kBehind)
+    {
+        LEPONG_CHECK_OR_RETURN_VAL(velocity.x != 0.0f, false);
+
+        entry = Entry{};
+        entry.velocityX = velocity.x;
+        entry.speedY = kSpeedY;
+        entry.inverseVelocityX = 1.0f / velocity.x;
+    }
+
+    entry.lastX = position.x;
+
+    // Planes behind the ball aren't cached, there is nothing to predict.
+    LEPONG_CHECK_OR_RETURN_VAL(PredictIntercept(position, velocity, planeX, mMinY, mMaxY, intercept), false);
+
+    ++mMisses;
+
+    const auto kSlot = entry.nextPlane;
+
+    entry.planeX[kSlot] = planeX;
+    entry.y[kSlot] = intercept.y;
+
+    entry.nextPlane = (kSlot + 1) % skCachedPlanes;
+    entry.planes = entry.planes < skCachedPlanes ? entry.planes + 1 : skCachedPlanes;
+
+    return true;
+}
+
+bool TrajectoryPredictor::PredictPaddle(std::size_t ball, const Match& match, unsigned player, Intercept& intercept) noexcept
+{
+    const auto& kPaddle = match.GetPaddle(player);
+    const auto kPlaneX = kPaddle.position.x + (kPaddle.size.x / 2.0f + match.ball.radius) * kPaddle.forward;
+
+    return Predict(ball, match.ball.position, match.ball.moveDirection * match.ball.moveSpeed, kPlaneX, intercept);
+}
+
+} // namespace lepong
@@ -0,0 +1,139 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lepong/Attribute.h"
+
+namespace lepong
+{
+
+///
+/// Runs the same job on a fixed set of threads and waits for all of them, for work split in equal parts that must
+/// finish before the caller goes on. The calling thread takes part as thread 0 so a group of 1 starts no thread.
+///
+class WorkerGroup
+{
+public:
+    ///
+    /// \param thread The index of the thread running the job, in [0, threadCount).
+    ///
+    using PFNJob = void (*)(void* userData, unsigned thread, unsigned threadCount);
+
+public:
+    explicit WorkerGroup(unsigned threadCount) noexcept
+    {
+        threadCount = threadCount ? threadCount : 1u;
+        mThreads.reserve(threadCount - 1u);
+
+        for (auto i = 1u; i < threadCount; ++i)
+        {
+            mThreads.emplace_back(&WorkerGroup::WorkerMain, this, i);
+        }
+    }
+
+    ~WorkerGroup() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopping = true;
+        }
+
+        mStart.notify_all();
+
+        for (auto& thread : mThreads)
+        {
+            thread.join();
+        }
+    }
+
+    WorkerGroup(const WorkerGroup&) = delete;
+    WorkerGroup& operator=(const WorkerGroup&) = delete;
+
+public:
+    void Run(PFNJob job, void* userData) noexcept
+    {
+        if (mThreads.empty())
+        {
+            job(userData, 0u, 1u);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mJob = job;
+            mUserData = userData;
+            mRunning = static_cast<unsigned>(mThreads.size());
+            ++mGeneration;
+        }
+
+        mStart.notify_all();
+        job(userData, 0u, GetThreadCount());
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDone.wait(lock, [this] { return mRunning == 0; });
+    }
+
+    LEPONG_NODISCARD unsigned GetThreadCount() const noexcept
+    {
+        return static_cast<unsigned>(mThreads.size()) + 1u;
+    }
+
+private:
+    void WorkerMain(unsigned index) noexcept
+    {
+        unsigned long long generation = 0;
+
+        while (true)
+        {
+            PFNJob job = nullptr;
+            void* userData = nullptr;
+
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mStart.wait(lock, [&] { return mStopping || mGeneration != generation; });
+
+                if (mStopping)
+                {
+                    return;
+                }
+
+                generation = mGeneration;
+                job = mJob;
+                userData = mUserData;
+            }
+
+            job(userData, index, GetThreadCount());
+
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            if (--mRunning == 0)
+            {
+                mDone.notify_one();
+            }
+        }
+    }
+
+private:
+    std::vector<std::thread> mThreads;
+
+    std::mutex mMutex;
+    std::condition_variable mStart;
+    std::condition_variable mDone;
+
+    unsigned long long mGeneration = 0;
+    unsigned mRunning = 0;
+    bool mStopping = false;
+
+    PFNJob mJob = nullptr;
+    void* mUserData = nullptr;
+};
+
+} // namespace lepong
@@ -0,0 +1,1203 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+// Headless batch match runner. Plays bot vs bot matches as fast as the CPU allows and reports the throughput.
+//
+// Usage: lepong_sim [--matches N] [--points N] [--rate HZ] [--seed N] [--batch N] [--kernel NAME] [--verify] [--swept] [--events]
+//                  [--scalar float|fixed] [--threads N] [--pin] [--net loopback|udp] [--latency MS] [--jitter MS]
+//                  [--loss PERCENT] [--delay TICKS] [--replays] [--record FILE] [--replay FILE]
+//                  [--serve NAME] [--envs N] [--pixels] [--poll] [--tournament N] [--swiss ROUNDS] [--games N]
+//                  [--results FILE] [--sweep SPEC]
+//
+// Batches: with --batch, N matches are stepped at once by a MatchBatch using the provided kernel. With --verify, the
+// kernel is checked against the reference kernel instead of being timed.
+//
+// Continuous collision: with --swept, the matches use continuous collision, which stays accurate at low tick rates.
+// The batch kernels don't support it.
+//
+// Events: with --events, the matches are played by the event driven fast-forward with intercepting bots and the tick
+// rate is ignored. Matches that time out before a side reaches --points are counted as draws.
+//
+// Fixed point: with --scalar, the matches are played by a ScalarMatch with the provided number type, which compares
+// the cost of fixed point to float. With --scalar float --verify, ScalarMatch is checked against Match instead.
+//
+// Threads: with --threads, the matches are played by a MatchFarm with N threads (0 for one per hardware thread),
+// pinned to CPUs with --pin. Match i is seeded from the seed and i so the results don't depend on the thread count.
+//
+// Netcode: with --net, a single match is played by two rollback peers in the same process, over an in-process link or
+// UDP sockets on the loopback interface, with the provided link conditions in each direction and input delay. Each
+// peer's bot only sees its own predicted match, then both peers are checked to have ended in the same state.
+//
+// Replays: with --replays, every match is recorded then played again from its replay, which is checked to end in the
+// recorded state. --record also saves the replay of the first match to a file and --replay plays a saved replay.
+//
+// Learning environments: with --serve, N learning environments (1024 by default) are run for a trainer process that
+// connects to the shared memory NAME, with pixel observations with --pixels, waiting by polling instead of sleeping
+// with --poll.
+//
+// Tournaments: with --tournament, N bots of different styles play a round robin, or ROUNDS Swiss rounds with --swiss,
+// of --games matches per pair (100 by default) on a MatchFarm of --threads threads, and are rated with Elo and
+// TrueSkill. --results saves the ratings and the results of every pair to a file.
+//
+// Sweeps: with --sweep, --matches matches are played for every combination of rules in SPEC, a comma separated list
+// of NAME=MIN:MAX:STEPS or NAME=VALUE where NAME is ball, paddle, gain, grace or height. They are played in chunks of
+// 256 matches, --batch at a time (1024 by default), on --threads threads, and the rally lengths, point times and win
+// rates of every combination are printed.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "lepong/Check.h"
+#include "lepong/Game/Bot.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Net/RollbackSession.h"
+#include "lepong/Net/UdpTransport.h"
+#include "lepong/Sim/FastForward.h"
+#include "lepong/Sim/MatchBatch.h"
+#include "lepong/Sim/MatchFarm.h"
+#include "lepong/Sim/ParameterSweep.h"
+#include "lepong/Sim/Replay.h"
+#include "lepong/Sim/ScalarMatch.h"
+#include "lepong/Sim/Tournament.h"
+#include "lepong/VecEnv.h"
+
+namespace
+{
+
+struct Options
+{
+    unsigned long matches = 1000;
+    unsigned long points = 5;
+    unsigned long rate = 240;
+    unsigned long seed = 0;
+
+    // Set by --threads, the value only counts when threaded is set.
+    unsigned long threads = 0;
+    bool threaded = false;
+    bool pin = false;
+
+    unsigned long batch = 0;
+    lepong::BatchKernel kernel = lepong::BatchKernel::Auto;
+    bool verify = false;
+    bool swept = false;
+    bool events = false;
+
+    enum class Scalar
+    {
+        None,
+        Float,
+        Fixed
+    } scalar = Scalar::None;
+
+    enum class Net
+    {
+        None,
+        Loopback,
+        Udp
+    } net = Net::None;
+
+    unsigned long latency = 0;
+    unsigned long jitter = 0;
+    unsigned long loss = 0;
+    unsigned long delay = 0;
+
+    bool replays = false;
+    const char* record = nullptr;
+    const char* replay = nullptr;
+
+    const char* serve = nullptr;
+    unsigned long envs = 1024;
+    bool pixels = false;
+    bool poll = false;
+
+    unsigned long tournament = 0;
+    unsigned long swiss = 0;
+    unsigned long games = 100;
+    const char* results = nullptr;
+
+    const char* sweep = nullptr;
+};
+
+///
+/// What a run reports.
+///
+struct Results
+{
+    unsigned long matches = 0;
+    unsigned long wins[2] = { 0ul, 0ul };
+    unsigned long long ticks = 0;
+
+    // Only filled by the event driven runs. Matches with a point that timed out count for nobody.
+    unsigned long long events = 0;
+    double matchTime = 0.0;
+    unsigned long draws = 0;
+
+    // Only filled with --replays, one per match.
+    std::vector<lepong::Replay> replays;
+};
+
+// Stops matches that somehow never end, a match at the default rate shouldn't get anywhere near this.
+constexpr unsigned long long skMaxTicksPerMatch = lepong::BotMatchSettings{}.maxTicks;
+
+///
+/// \return Whether the arguments were all recognized.
+///
+bool ParseOptions(int argc, char** argv, Options& options) noexcept
+{
+    for (auto i = 1; i < argc; ++i)
+    {
+        const auto kHasValue = (i + 1) < argc;
+        unsigned long* target = nullptr;
+
+        if (!std::strcmp(argv[i], "--matches"))
+        {
+            target = &options.matches;
+        }
+        else if (!std::strcmp(argv[i], "--points"))
+        {
+            target = &options.points;
+        }
+        else if (!std::strcmp(argv[i], "--rate"))
+        {
+            target = &options.rate;
+        }
+        else if (!std::strcmp(argv[i], "--seed"))
+        {
+            target = &options.seed;
+        }
+        else if (!std::strcmp(argv[i], "--threads"))
+        {
+            options.threaded = true;
+            target = &options.threads;
+        }
+        else if (!std::strcmp(argv[i], "--pin"))
+        {
+            options.pin = true;
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--batch"))
+        {
+            target = &options.batch;
+        }
+        else if (!std::strcmp(argv[i], "--kernel"))
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(kHasValue, false);
+            LEPONG_CHECK_OR_RETURN_VAL(lepong::ParseBatchKernel(argv[++i], options.kernel), false);
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--verify"))
+        {
+            options.verify = true;
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--swept"))
+        {
+            options.swept = true;
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--scalar"))
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(kHasValue, false);
+            ++i;
+
+            if (!std::strcmp(argv[i], "float"))
+            {
+                options.scalar = Options::Scalar::Float;
+            }
+            else if (!std::strcmp(argv[i], "fixed"))
+            {
+                options.scalar = Options::Scalar::Fixed;
+            }
+            else
+            {
+                return false;
+            }
+
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--events"))
+        {
+            options.events = true;
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--net"))
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(kHasValue, false);
+            ++i;
+
+            if (!std::strcmp(argv[i], "loopback"))
+            {
+                options.net = Options::Net::Loopback;
+            }
+            else if (!std::strcmp(argv[i], "udp"))
+            {
+                options.net = Options::Net::Udp;
+            }
+            else
+            {
+                return false;
+            }
+
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--replays"))
+        {
+            options.replays = true;
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--record"))
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(kHasValue, false);
+            options.replays = true;
+            options.record = argv[++i];
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--replay"))
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(kHasValue, false);
+            options.replay = argv[++i];
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--serve"))
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(kHasValue, false);
+            options.serve = argv[++i];
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--envs"))
+        {
+            target = &options.envs;
+        }
+        else if (!std::strcmp(argv[i], "--pixels"))
+        {
+            options.pixels = true;
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--poll"))
+        {
+            options.poll = true;
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--tournament"))
+        {
+            target = &options.tournament;
+        }
+        else if (!std::strcmp(argv[i], "--swiss"))
+        {
+            target = &options.swiss;
+        }
+        else if (!std::strcmp(argv[i], "--games"))
+        {
+            target = &options.games;
+        }
+        else if (!std::strcmp(argv[i], "--results"))
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(kHasValue, false);
+            options.results = argv[++i];
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--sweep"))
+        {
+            LEPONG_CHECK_OR_RETURN_VAL(kHasValue, false);
+            options.sweep = argv[++i];
+            continue;
+        }
+        else if (!std::strcmp(argv[i], "--latency"))
+        {
+            target = &options.latency;
+        }
+        else if (!std::strcmp(argv[i], "--jitter"))
+        {
+            target = &options.jitter;
+        }
+        else if (!std::strcmp(argv[i], "--loss"))
+        {
+            target = &options.loss;
+        }
+        else if (!std::strcmp(argv[i], "--delay"))
+        {
+            target = &options.delay;
+        }
+
+        LEPONG_CHECK_OR_RETURN_VAL(target && kHasValue, false);
+
+        *target = std::strtoul(argv[++i], nullptr, 10);
+    }
+
+    // The batch kernels and the scalar matches only do discrete collision.
+    const auto kModes =
+        (options.batch && !options.sweep ? 1 : 0) +
+        (options.events ? 1 : 0) +
+        (options.scalar != Options::Scalar::None ? 1 : 0) +
+        (options.threaded && !options.tournament && !options.sweep ? 1 : 0) +
+        (options.net != Options::Net::None ? 1 : 0) +
+        (options.serve ? 1 : 0) +
+        (options.tournament ? 1 : 0) +
+        (options.sweep ? 1 : 0);
+
+    const auto kSweptSupported = !options.batch && options.scalar == Options::Scalar::None;
+
+    // Only the Match runs can be recorded.
+    const auto kReplaysSupported = kModes == 0 || options.threaded;
+
+    // The tournaments and sweeps play their own matches.
+    const auto kOwnMatches = options.tournament || options.sweep;
+
+    return
+        options.points && options.rate && options.envs && options.games && kModes <= 1 &&
+        (!options.tournament || options.tournament >= 2) && (!kOwnMatches || (!options.swept && !options.replays)) &&
+        (!options.swept || kSweptSupported) && options.loss <= 100 && (!options.replays || kReplaysSupported);
+}
+
+///
+/// Plays the matches one after the other with Match objects.
+///
+void RunMatches(const Options& options, float delta, Results& results) noexcept
+{
+    lepong::BotMatchSettings settings;
+    settings.points = static_cast<unsigned>(options.points);
+    settings.delta = delta;
+    settings.continuousCollision = options.swept;
+
+    if (options.replays)
+    {
+        results.replays.resize(options.matches);
+        settings.replays = results.replays.data();
+    }
+
+    for (unsigned long i = 0; i < options.matches; ++i)
+    {
+        // Seeded like the farm seeds its matches.
+        lepong::Match match;
+        match.random = lepong::Random(options.seed, i);
+
+        lepong::MatchResult result;
+        lepong::PlayBotMatch(match, i, result, &settings);
+
+        results.ticks += result.ticks;
+
+        ++results.wins[result.scores[1] > result.scores[0] ? 1 : 0];
+        ++results.matches;
+    }
+}
+
+///
+/// Plays the matches on a MatchFarm.
+///
+void RunFarm(const Options& options, float delta, Results& results) noexcept
+{
+    lepong::BotMatchSettings settings;
+    settings.points = static_cast<unsigned>(options.points);
+    settings.delta = delta;
+    settings.continuousCollision = options.swept;
+
+    if (options.replays)
+    {
+        results.replays.resize(options.matches);
+        settings.replays = results.replays.data();
+    }
+
+    lepong::MatchFarmSettings farmSettings;
+    farmSettings.threads = static_cast<unsigned>(options.threads);
+    farmSettings.pinThreads = options.pin;
+    farmSettings.seed = options.seed;
+
+    lepong::MatchFarm farm(farmSettings);
+    std::vector<lepong::MatchResult> matchResults(options.matches);
+
+    farm.Run(matchResults.size(), lepong::PlayBotMatch, &settings, matchResults.data());
+
+    for (const auto& kResult : matchResults)
+    {
+        results.ticks += kResult.ticks;
+
+        ++results.wins[kResult.scores[1] > kResult.scores[0] ? 1 : 0];
+        ++results.matches;
+    }
+
+    std::printf("threads:      %u (%llu steals)\n", farm.GetThreadCount(), farm.GetSteals());
+}
+
+///
+/// Plays the matches one after the other with ScalarMatch objects.
+///
+template<typename Scalar>
+void RunScalarMatches(const Options& options, Scalar delta, Results& results) noexcept
+{
+    for (unsigned long i = 0; i < options.matches; ++i)
+    {
+        lepong::ScalarMatch<Scalar> match;
+        match.random = lepong::Random(options.seed, i);
+
+        unsigned long long ticks = 0;
+
+        while (match.scores[0] < options.points && match.scores[1] < options.points && ticks < skMaxTicksPerMatch)
+        {
+            if (!match.playing)
+            {
+                match.Launch();
+            }
+
+            const lepong::PaddleAction kActions[] = { match.TrackBall(0), match.TrackBall(1) };
+
+            match.Update(delta, kActions);
+            ++ticks;
+        }
+
+        results.ticks += ticks;
+
+        ++results.wins[match.scores[1] > match.scores[0] ? 1 : 0];
+        ++results.matches;
+    }
+}
+
+///
+/// Plays matches with a Match and a ScalarMatch of floats side by side from the same seed.
+///
+/// \return Whether both ended in the exact same state.
+///
+bool VerifyScalarMatch(const Options& options, float delta) noexcept
+{
+    constexpr auto kTicks = 5'000'000;
+
+    lepong::Match match;
+    match.random = lepong::Random(options.seed);
+
+    // Both launches get the same random signs.
+    lepong::ScalarMatch<float> scalarMatch;
+    scalarMatch.random = match.random;
+
+    auto same = true;
+
+    for (auto t = 0; t < kTicks && same; ++t)
+    {
+        if (!match.playing)
+        {
+            match.Launch();
+            scalarMatch.Launch();
+        }
+
+        const lepong::PaddleAction kActions[] = { scalarMatch.TrackBall(0), scalarMatch.TrackBall(1) };
+
+        match.paddle1.ApplyAction(kActions[0]);
+        match.paddle2.ApplyAction(kActions[1]);
+
+        match.Update(delta);
+        scalarMatch.Update(delta, kActions);
+
+        lepong::Match stored;
+        scalarMatch.Store(stored);
+
+        same =
+            !std::memcmp(&stored.ball.position, &match.ball.position, sizeof(lepong::Vector2f)) &&
+            !std::memcmp(&stored.ball.moveDirection, &match.ball.moveDirection, sizeof(lepong::Vector2f)) &&
+            !std::memcmp(&stored.ball.moveSpeed, &match.ball.moveSpeed, sizeof(float)) &&
+            !std::memcmp(&stored.paddle1.position, &match.paddle1.position, sizeof(lepong::Vector2f)) &&
+            !std::memcmp(&stored.paddle2.position, &match.paddle2.position, sizeof(lepong::Vector2f)) &&
+            stored.scores[0] == match.scores[0] &&
+            stored.scores[1] == match.scores[1];
+    }
+
+    std::printf("float ScalarMatch vs Match over %d ticks: %s (score %u - %u)\n",
+        kTicks, same ? "identical" : "MISMATCH", match.scores[0], match.scores[1]);
+
+    return same;
+}
+
+///
+/// \return Whether both matches are in the exact same state.
+///
+bool SameMatch(const lepong::Match& a, const lepong::Match& b) noexcept
+{
+    return
+        !std::memcmp(&a.ball.position, &b.ball.position, sizeof(lepong::Vector2f)) &&
+        !std::memcmp(&a.ball.moveDirection, &b.ball.moveDirection, sizeof(lepong::Vector2f)) &&
+        !std::memcmp(&a.ball.moveSpeed, &b.ball.moveSpeed, sizeof(float)) &&
+        !std::memcmp(&a.paddle1.position, &b.paddle1.position, sizeof(lepong::Vector2f)) &&
+        !std::memcmp(&a.paddle2.position, &b.paddle2.position, sizeof(lepong::Vector2f)) &&
+        a.scores[0] == b.scores[0] &&
+        a.scores[1] == b.scores[1] &&
+        a.playing == b.playing &&
+        a.random.state == b.random.state;
+}
+
+///
+/// Plays every recorded match again from its replay.
+///
+/// \return Whether every replay ended in the recorded state.
+///
+bool CheckReplays(const Options& options, const Results& results) noexcept
+{
+    std::size_t bytes = 0;
+    std::size_t largest = 0;
+    unsigned long long ticks = 0;
+    unsigned long long events = 0;
+    unsigned long failures = 0;
+
+    const auto kStart = std::chrono::steady_clock::now();
+
+    for (const auto& kReplay : results.replays)
+    {
+        lepong::Match match;
+        lepong::ReplayInfo info;
+
+        failures += lepong::PlayReplay(kReplay, match, &info) != lepong::ReplayStatus::Ok ? 1 : 0;
+
+        bytes += kReplay.size();
+        largest = std::max(largest, kReplay.size());
+        ticks += info.ticks;
+        events += info.events;
+    }
+
+    const auto kSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - kStart).count();
+    const auto kCount = static_cast<double>(results.replays.size());
+    const auto kGameSeconds = static_cast<double>(ticks) / static_cast<double>(options.rate);
+
+    std::printf("replays:      %.1f bytes per match (largest %zu), %.1f events per match\n",
+        static_cast<double>(bytes) / kCount, largest, static_cast<double>(events) / kCount);
+    std::printf("playback:     %.3f s, %.0fx real time\n", kSeconds, kGameSeconds / kSeconds);
+    std::printf("verified:     %lu of %zu\n", results.replays.size() - failures, results.replays.size());
+
+    if (options.record && !results.replays.empty() && !lepong::SaveReplay(results.replays.front(), options.record))
+    {
+        std::fprintf(stderr, "could not write %s\n", options.record);
+        return false;
+    }
+
+    return failures == 0;
+}
+
+///
+/// Plays a saved replay.
+///
+/// \return Whether the replay was valid and ended in the recorded state.
+///
+bool PlaySavedReplay(const char* path) noexcept
+{
+    lepong::Replay replay;
+
+    if (!lepong::LoadReplay(path, replay))
+    {
+        std::fprintf(stderr, "could not read %s\n", path);
+        return false;
+    }
+
+    lepong::Match match;
+    lepong::ReplayInfo info;
+
+    const auto kStatus = lepong::PlayReplay(replay, match, &info);
+
+    constexpr const char* kStatusNames[] = { "ok", "malformed", "desync" };
+
+    std::printf("replay:       %zu bytes, %llu ticks, %llu events\n", replay.size(),
+        static_cast<unsigned long long>(info.ticks), static_cast<unsigned long long>(info.events));
+    std::printf("score:        %u - %u\n", match.scores[0], match.scores[1]);
+    std::printf("status:       %s\n", kStatusNames[static_cast<int>(kStatus)]);
+
+    return kStatus == lepong::ReplayStatus::Ok;
+}
+
+///
+/// \return <i>count</i> bot styles, every combination of the tracking modes, dead zones and aims before repeating.
+///
+std::vector<lepong::BotStyle> MakeBotStyles(unsigned long count) noexcept
+{
+    constexpr float kDeadZones[] = { 5.0f, 15.0f, 30.0f, 60.0f, 100.0f };
+    constexpr float kAims[] = { 0.0f, 0.4f, -0.4f, 0.8f, -0.8f };
+
+    std::vector<lepong::BotStyle> styles(count);
+
+    for (unsigned long i = 0; i < count; ++i)
+    {
+        styles[i].predict = (i % 2) != 0;
+        styles[i].deadZone = kDeadZones[(i / 2) % std::size(kDeadZones)];
+        styles[i].aim = kAims[(i / (2 * std::size(kDeadZones))) % std::size(kAims)];
+    }
+
+    return styles;
+}
+
+///
+/// Plays a tournament between bots of different styles and prints the standings.
+///
+/// \return Whether the results could be saved, when asked to.
+///
+bool RunTournament(const Options& options, float delta) noexcept
+{
+    auto styles = MakeBotStyles(options.tournament);
+    std::vector<lepong::TournamentPlayer> players(styles.size());
+
+    for (std::size_t i = 0; i < styles.size(); ++i)
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s-dz%.0f-aim%+.1f#%zu",
+            styles[i].predict ? "predict" : "track", styles[i].deadZone, styles[i].aim, i);
+
+        players[i] = { name, lepong::PlayBotStyle, &styles[i] };
+    }
+
+    lepong::TournamentSettings settings;
+    settings.pairing = options.swiss ? lepong::TournamentSettings::Pairing::Swiss : lepong::TournamentSettings::Pairing::RoundRobin;
+    settings.rounds = static_cast<unsigned>(options.swiss);
+    settings.games = static_cast<unsigned>(options.games);
+    settings.points = static_cast<unsigned>(options.points);
+    settings.delta = delta;
+    settings.farm.threads = static_cast<unsigned>(options.threads);
+    settings.farm.pinThreads = options.pin;
+    settings.farm.seed = options.seed;
+
+    lepong::Tournament tournament(settings);
+
+    const auto kStart = std::chrono::steady_clock::now();
+    tournament.Run(players);
+    const auto kSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - kStart).count();
+
+    const auto& kRatings = tournament.GetRatings();
+
+    std::vector<std::size_t> order(kRatings.size());
+
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+    {
+        return kRatings[a].GetConservative() > kRatings[b].GetConservative();
+    });
+
+    std::printf("%4s %-28s %8s %8s %8s\n", "rank", "player", "elo", "mu", "sigma");
+
+    for (std::size_t r = 0; r < order.size(); ++r)
+    {
+        const auto& kRating = kRatings[order[r]];
+        std::printf("%4zu %-28s %8.1f %8.2f %8.2f\n", r + 1, players[order[r]].name.c_str(), kRating.elo, kRating.mu, kRating.sigma);
+    }
+
+    const auto kMatches = static_cast<double>(tournament.GetMatchCount());
+
+    std::printf("pairs:        %zu\n", tournament.GetPairs().size());
+    std::printf("matches:      %llu\n", static_cast<unsigned long long>(tournament.GetMatchCount()));
+    std::printf("threads:      %u\n", tournament.GetThreadCount());
+    std::printf("elapsed:      %.3f s\n", kSeconds);
+    std::printf("matches/sec:  %.1f\n", kMatches / kSeconds);
+    std::printf("ticks/sec:    %.1f\n", static_cast<double>(tournament.GetTickCount()) / kSeconds);
+
+    if (options.results && !tournament.Save(options.results))
+    {
+        std::fprintf(stderr, "could not write %s\n", options.results);
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// Reads a sweep specification into the ranges of <i>settings</i>.
+///
+/// \return Whether every entry names a parameter and has a valid range.
+///
+bool ParseSweep(const char* spec, lepong::SweepSettings& settings) noexcept
+{
+    while (*spec)
+    {
+        const auto* kEnd = std::strchr(spec, ',');
+        const auto* kEquals = std::strchr(spec, '=');
+
+        kEnd = kEnd ? kEnd : spec + std::strlen(spec);
+        LEPONG_CHECK_OR_RETURN_VAL(kEquals && kEquals < kEnd, false);
+
+        const std::string kName(spec, kEquals);
+        lepong::SweepRange* range = nullptr;
+
+        if (kName == "ball")
+        {
+            range = &settings.ballSpeed;
+        }
+        else if (kName == "paddle")
+        {
+            range = &settings.paddleSpeed;
+        }
+        else if (kName == "gain")
+        {
+            range = &settings.hitSpeedGain;
+        }
+        else if (kName == "grace")
+        {
+            range = &settings.graceZone;
+        }
+        else if (kName == "height")
+        {
+            range = &settings.paddleHeight;
+        }
+
+        LEPONG_CHECK_OR_RETURN_VAL(range, false);
+
+        // MIN:MAX:STEPS, or a single value.
+        char* next = nullptr;
+        range->min = std::strtof(kEquals + 1, &next);
+        range->max = range->min;
+        range->steps = 1;
+
+        if (*next == ':')
+        {
+            range->max = std::strtof(next + 1, &next);
+            LEPONG_CHECK_OR_RETURN_VAL(*next == ':', false);
+
+            range->steps = static_cast<unsigned>(std::strtoul(next + 1, &next, 10));
+        }
+
+        LEPONG_CHECK_OR_RETURN_VAL(next == kEnd && range->steps, false);
+        spec = *kEnd ? kEnd + 1 : kEnd;
+    }
+
+    return true;
+}
+
+///
+/// Plays every combination of rules of the sweep and prints a line of statistics per combination.
+///
+/// \return Whether the sweep specification was valid.
+///
+bool RunSweep(const Options& options, float delta) noexcept
+{
+    lepong::SweepSettings settings;
+    LEPONG_CHECK_OR_RETURN_VAL(ParseSweep(options.sweep, settings), false);
+
+    settings.matches = options.matches;
+    settings.points = static_cast<unsigned>(options.points);
+    settings.lanes = options.batch ? static_cast<unsigned>(options.batch) : settings.lanes;
+    settings.delta = delta;
+    settings.threads = static_cast<unsigned>(options.threads);
+    settings.seed = options.seed;
+    settings.kernel = options.kernel;
+
+    lepong::ParameterSweep sweep(settings);
+
+    const auto kStart = std::chrono::steady_clock::now();
+    sweep.Run();
+    const auto kSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - kStart).count();
+
+    std::printf("%7s %7s %6s %6s %6s | %8s %6s %6s | %8s %7s %7s | %6s %6s %6s | %s\n",
+        "ball", "paddle", "gain", "grace", "height",
+        "hits", "p50", "p99",
+        "point s", "p50", "p99",
+        "p1 win", "share", "sd",
+        "timeouts");
+
+    std::uint64_t matches = 0;
+
+    for (const auto& kResult : sweep.GetResults())
+    {
+        const auto& kRules = kResult.rules;
+        const auto kMatches = static_cast<double>(kResult.matches);
+
+        std::printf("%7.1f %7.1f %6.1f %6.3f %6.1f | %8.2f %6.0f %6.0f | %8.2f %7.2f %7.2f | %6.3f %6.3f %6.3f | %llu\n",
+            kRules.ballSpeed, kRules.paddleSpeed, kRules.hitSpeedGain, kRules.graceZone, kRules.paddleHeight,
+            kResult.rallyLength.GetMean(), kResult.rallyLength.GetQuantile(0.5), kResult.rallyLength.GetQuantile(0.99),
+            kResult.pointTime.GetMean(), kResult.pointTime.GetQuantile(0.5), kResult.pointTime.GetQuantile(0.99),
+            kMatches > 0.0 ? static_cast<double>(kResult.wins[0]) / kMatches : 0.0,
+            kResult.pointShare.GetMean(), kResult.pointShare.GetStandardDeviation(),
+            static_cast<unsigned long long>(kResult.timeouts));
+
+        matches += kResult.matches;
+    }
+
+    const auto kTicks = static_cast<double>(sweep.GetTickCount());
+
+    std::printf("configurations: %zu\n", sweep.GetGrid().size());
+    std::printf("matches:      %llu\n", static_cast<unsigned long long>(matches));
+    std::printf("threads:      %u\n", sweep.GetThreadCount());
+    std::printf("elapsed:      %.3f s\n", kSeconds);
+    std::printf("matches/sec:  %.1f\n", static_cast<double>(matches) / kSeconds);
+    std::printf("ticks/sec:    %.1f\n", kTicks / kSeconds);
+
+    return true;
+}
+
+///
+/// Runs learning environments for a trainer process until it leaves.
+///
+/// \return Whether the environments could be shared.
+///
+bool Serve(const Options& options, float delta) noexcept
+{
+    LepongVecEnvSettings settings;
+    lepong_vecenv_default_settings(&settings);
+
+    settings.envCount = static_cast<std::uint32_t>(options.envs);
+    settings.seed = options.seed;
+    settings.observation = options.pixels ? LEPONG_OBSERVATION_PIXELS : LEPONG_OBSERVATION_VECTOR;
+    settings.tickDelta = delta;
+
+    std::printf("serving %lu environments at %s\n", options.envs, options.serve);
+    std::fflush(stdout);
+
+    if (lepong_vecenv_serve(options.serve, &settings, options.poll ? LEPONG_WAIT_POLL : LEPONG_WAIT_FUTEX))
+    {
+        std::fprintf(stderr, "could not serve at %s\n", options.serve);
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// Plays a match between two rollback peers, each one driving its paddle with a bot that sees its own match.
+///
+/// \return Whether the peers could talk to each other and ended in the same state.
+///
+bool RunNet(const Options& options, float delta) noexcept
+{
+    lepong::Net::LinkConditions conditions;
+    conditions.latency = static_cast<double>(options.latency) / 1000.0;
+    conditions.jitter = static_cast<double>(options.jitter) / 1000.0;
+    conditions.loss = static_cast<float>(options.loss) / 100.0f;
+
+    // Each direction drops different packets.
+    lepong::Net::LinkConditions conditions2 = conditions;
+    conditions.seed = options.seed * 2;
+    conditions2.seed = options.seed * 2 + 1;
+
+    lepong::Net::LoopbackTransport loopbacks[] = { lepong::Net::LoopbackTransport(conditions), lepong::Net::LoopbackTransport(conditions2) };
+    lepong::Net::UdpTransport sockets[] = { lepong::Net::UdpTransport(conditions), lepong::Net::UdpTransport(conditions2) };
+
+    lepong::Net::Transport* transports[2] = { &loopbacks[0], &loopbacks[1] };
+
+    if (options.net == Options::Net::Udp)
+    {
+        constexpr std::uint16_t kPorts[] = { 47001, 47002 };
+
+        if (!sockets[0].Open(kPorts[0], kPorts[1]) || !sockets[1].Open(kPorts[1], kPorts[0]))
+        {
+            std::fputs("could not open the UDP sockets\n", stderr);
+            return false;
+        }
+
+        transports[0] = &sockets[0];
+        transports[1] = &sockets[1];
+    }
+    else
+    {
+        lepong::Net::LoopbackTransport::Connect(loopbacks[0], loopbacks[1]);
+    }
+
+    lepong::Match match;
+    match.random = lepong::Random(options.seed);
+
+    lepong::Net::RollbackSettings settings;
+    settings.inputDelay = static_cast<unsigned>(options.delay);
+    settings.tickDelta = delta;
+
+    lepong::Net::RollbackSettings settings2 = settings;
+    settings2.localPlayer = 1;
+
+    lepong::Net::RollbackSession sessions[] =
+    {
+        lepong::Net::RollbackSession(settings, *transports[0], match),
+        lepong::Net::RollbackSession(settings2, *transports[1], match)
+    };
+
+    unsigned long long frames = 0;
+
+    const auto kStart = std::chrono::steady_clock::now();
+
+    for (; frames < skMaxTicksPerMatch; ++frames)
+    {
+        const auto& kMatch = sessions[0].GetMatch();
+
+        if (kMatch.scores[0] >= options.points || kMatch.scores[1] >= options.points)
+        {
+            break;
+        }
+
+        for (unsigned player = 0; player < 2; ++player)
+        {
+            const auto& kView = sessions[player].GetMatch();
+            sessions[player].AdvanceFrame(lepong::TrackBall(kView.GetPaddle(player), kView.ball));
+        }
+    }
+
+    const auto kSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - kStart).count();
+
+    // The last tick whose inputs both peers have, both must have simulated it the same way.
+    const auto kTick = std::min(sessions[0].GetConfirmedTicks(), sessions[1].GetConfirmedTicks());
+
+    const auto* states0 = sessions[0].GetSnapshots().Find(kTick);
+    const auto* states1 = sessions[1].GetSnapshots().Find(kTick);
+
+    const auto kSame = states0 && states1 && SameMatch(states0->match, states1->match);
+
+    std::printf("frames:       %llu in %.3f s\n", frames, kSeconds);
+
+    for (unsigned player = 0; player < 2; ++player)
+    {
+        const auto& kStats = sessions[player].GetStats();
+        const auto& kMatch = sessions[player].GetMatch();
+
+        const auto kAverage = kStats.rollbacks ? kStats.rollbackTime / static_cast<double>(kStats.rollbacks) : 0.0;
+
+        std::printf("peer %u:       tick %llu, score %u - %u\n", player + 1,
+            static_cast<unsigned long long>(sessions[player].GetTick()), kMatch.scores[0], kMatch.scores[1]);
+        std::printf("  rollbacks:  %llu (%llu ticks, max %u)\n",
+            kStats.rollbacks, kStats.resimulatedTicks, kStats.maxRollbackTicks);
+        std::printf("  rollback:   %.1f us average, %.1f us max\n", kAverage * 1e6, kStats.maxRollbackTime * 1e6);
+        std::printf("  stalls:     %llu\n", kStats.stalls);
+        std::printf("  packets:    %llu sent, %llu received\n", kStats.packetsSent, kStats.packetsReceived);
+    }
+
+    std::printf("confirmed:    tick %llu %s\n", static_cast<unsigned long long>(kTick), kSame ? "identical" : "MISMATCH");
+
+    return kSame;
+}
+
+///
+/// Plays the matches one after the other with the event driven fast-forward.
+///
+void RunEvents(const Options& options, Results& results) noexcept
+{
+    lepong::FastForwardSettings settings;
+    settings.controllers[0].function = lepong::InterceptBall;
+    settings.controllers[1].function = lepong::InterceptBall;
+
+    lepong::FastForwardStats stats;
+
+    for (unsigned long i = 0; i < options.matches; ++i)
+    {
+        lepong::Match match;
+        match.random = lepong::Random(options.seed, i);
+
+        while (match.scores[0] < options.points && match.scores[1] < options.points)
+        {
+            match.Launch();
+
+            if (lepong::FastForwardPoint(match, settings, stats) == lepong::Side::None)
+            {
+                // The point timed out, count it as a draw so the match can't go on forever.
+                break;
+            }
+        }
+
+        if (match.scores[0] >= options.points || match.scores[1] >= options.points)
+        {
+            ++results.wins[match.scores[1] > match.scores[0] ? 1 : 0];
+        }
+        else
+        {
+            ++results.draws;
+        }
+
+        ++results.matches;
+    }
+
+    results.events = stats.events;
+    results.matchTime = stats.time;
+}
+
+///
+/// Plays the matches <i>options.batch</i> at a time. A lane starts a new match as soon as its match is over, so the
+/// last few matches may finish a bit past the requested count.
+///
+void RunBatch(const Options& options, float delta, Results& results) noexcept
+{
+    lepong::MatchBatch batch(options.batch);
+    batch.SetSeed(options.seed);
+    batch.SetKernel(options.kernel);
+
+    std::vector<lepong::PaddleAction> actions(2 * batch.Size());
+
+    while (results.matches < options.matches)
+    {
+        for (std::size_t i = 0; i < batch.Size(); ++i)
+        {
+            if (batch.playing[i])
+            {
+                continue;
+            }
+
+            if (batch.scores[0][i] >= options.points || batch.scores[1][i] >= options.points)
+            {
+                ++results.wins[batch.scores[1][i] > batch.scores[0][i] ? 1 : 0];
+                ++results.matches;
+
+                batch.Restart(i);
+            }
+
+            batch.Launch(i);
+        }
+
+        lepong::FillTrackBallActions(batch, actions.data());
+        batch.Step(delta, actions.data());
+
+        results.ticks += batch.Size();
+    }
+}
+
+///
+/// Steps a batch with the requested kernel and one with the reference kernel from the same seed, then compares them.
+///
+/// \return Whether both batches ended in the exact same state.
+///
+bool VerifyKernel(const Options& options, float delta) noexcept
+{
+    constexpr auto kTicks = 50'000;
+
+    lepong::MatchBatch batches[] = { lepong::MatchBatch(options.batch), lepong::MatchBatch(options.batch) };
+
+    batches[0].SetKernel(lepong::BatchKernel::Reference);
+    batches[1].SetKernel(options.kernel);
+
+    std::vector<lepong::PaddleAction> actions(2 * options.batch);
+
+    for (auto& batch : batches)
+    {
+        batch.SetSeed(options.seed);
+
+        for (auto t = 0; t < kTicks; ++t)
+        {
+            batch.LaunchWaiting();
+
+            lepong::FillTrackBallActions(batch, actions.data());
+            batch.Step(delta, actions.data());
+        }
+    }
+
+    const auto kSameFloats = [&](const std::vector<float>& a, const std::vector<float>& b)
+    {
+        return !std::memcmp(a.data(), b.data(), options.batch * sizeof(float));
+    };
+
+    auto same =
+        kSameFloats(batches[0].ballX, batches[1].ballX) &&
+        kSameFloats(batches[0].ballY, batches[1].ballY) &&
+        kSameFloats(batches[0].ballDirX, batches[1].ballDirX) &&
+        kSameFloats(batches[0].ballDirY, batches[1].ballDirY) &&
+        kSameFloats(batches[0].ballSpeed, batches[1].ballSpeed) &&
+        batches[0].playing == batches[1].playing;
+
+    for (auto p = 0; p < 2; ++p)
+    {
+        same = same &&
+            kSameFloats(batches[0].paddleY[p], batches[1].paddleY[p]) &&
+            kSameFloats(batches[0].paddleDir[p], batches[1].paddleDir[p]) &&
+            kSameFloats(batches[0].paddleSpeed[p], batches[1].paddleSpeed[p]) &&
+            batches[0].scores[p] == batches[1].scores[p];
+    }
+
+    std::printf("kernel %s vs reference over %d ticks: %s\n",
+        lepong::GetBatchKernelName(batches[1].GetKernel()), kTicks, same ? "identical" : "MISMATCH");
+
+    return same;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::fputs("usage: lepong_sim [--matches N] [--points N] [--rate HZ] [--seed N] [--batch N] [--kernel NAME] [--verify] [--swept] [--events] [--scalar float|fixed] [--threads N] [--pin] [--net loopback|udp] [--latency MS] [--jitter MS] [--loss PERCENT] [--delay TICKS] [--replays] [--record FILE] [--replay FILE] [--serve NAME] [--envs N] [--pixels] [--poll] [--tournament N] [--swiss ROUNDS] [--games N] [--results FILE] [--sweep SPEC]\n", stderr);
+        return -1;
+    }
+
+    const auto kDelta = 1.0f / static_cast<float>(options.rate);
+
+    if (options.verify && options.scalar == Options::Scalar::Float)
+    {
+        return VerifyScalarMatch(options, kDelta) ? 0 : -1;
+    }
+
+    if (options.replay)
+    {
+        return PlaySavedReplay(options.replay) ? 0 : -1;
+    }
+
+    if (options.net != Options::Net::None)
+    {
+        return RunNet(options, kDelta) ? 0 : -1;
+    }
+
+    if (options.serve)
+    {
+        return Serve(options, kDelta) ? 0 : -1;
+    }
+
+    if (options.tournament)
+    {
+        return RunTournament(options, kDelta) ? 0 : -1;
+    }
+
+    if (options.sweep)
+    {
+        return RunSweep(options, kDelta) ? 0 : -1;
+    }
+
+    if (options.verify)
+    {
+        return options.batch && VerifyKernel(options, kDelta) ? 0 : -1;
+    }
+
+    Results results;
+
+    const auto kStart = std::chrono::steady_clock::now();
+
+    if (options.events)
+    {
+        RunEvents(options, results);
+    }
+    else if (options.threaded)
+    {
+        RunFarm(options, kDelta, results);
+    }
+    else if (options.scalar == Options::Scalar::Float)
+    {
+        RunScalarMatches(options, kDelta, results);
+    }
+    else if (options.scalar == Options::Scalar::Fixed)
+    {
+        RunScalarMatches(options, lepong::Fixed(kDelta), results);
+    }
+    else if (options.batch)
+    {
+        RunBatch(options, kDelta, results);
+    }
+    else
+    {
+        RunMatches(options, kDelta, results);
+    }
+
+    const auto kEnd = std::chrono::steady_clock::now();
+    const auto kSeconds = std::chrono::duration<double>(kEnd - kStart).count();
+
+    std::printf("matches:      %lu (p1 %lu, p2 %lu)\n", results.matches, results.wins[0], results.wins[1]);
+    std::printf("elapsed:      %.3f s\n", kSeconds);
+    std::printf("matches/sec:  %.1f\n", static_cast<double>(results.matches) / kSeconds);
+
+    if (options.events)
+    {
+        std::printf("draws:        %lu\n", results.draws);
+        std::printf("events:       %llu (%.1f per match)\n",
+            results.events, static_cast<double>(results.events) / static_cast<double>(results.matches));
+        std::printf("match time:   %.1f s (%.1f per match)\n",
+            results.matchTime, results.matchTime / static_cast<double>(results.matches));
+        std::printf("events/sec:   %.1f\n", static_cast<double>(results.events) / kSeconds);
+    }
+    else
+    {
+        std::printf("ticks:        %llu\n", results.ticks);
+        std::printf("ticks/sec:    %.1f\n", static_cast<double>(results.ticks) / kSeconds);
+    }
+
+    if (options.replays)
+    {
+        return CheckReplays(options, results) ? 0 : -1;
+    }
+}
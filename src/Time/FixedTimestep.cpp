@@ -0,0 +1,35 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Time/FixedTimestep.h"
+
+namespace lepong::Time
+{
+
+unsigned FixedTimestep::Advance(float frameDelta) noexcept
+{
+    // Negative deltas shouldn't happen with a monotonic clock but would make the alpha meaningless.
+    if (frameDelta > 0.0f)
+    {
+        mAccumulator += frameDelta;
+    }
+
+    unsigned ticks = 0;
+
+    while (mAccumulator >= mTickDelta && ticks < mMaxTicksPerFrame)
+    {
+        mAccumulator -= mTickDelta;
+        ++ticks;
+    }
+
+    if (ticks == mMaxTicksPerFrame && mAccumulator >= mTickDelta)
+    {
+        // Too far behind, drop the time we can't catch up on.
+        mAccumulator = 0.0f;
+    }
+
+    return ticks;
+}
+
+} // namespace lepong::Time
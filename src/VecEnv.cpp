@@ -0,0 +1,325 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "lepong/Check.h"
+#include "lepong/Net/StepChannel.h"
+#include "lepong/Sim/MatchBatch.h"
+#include "lepong/Sim/Rasterizer.h"
+#include "lepong/VecEnv.h"
+
+#include "Sim/WorkerGroup.h"
+
+static_assert(LEPONG_VECENV_PIXELS_WIDTH == lepong::Rasterizer::skFrameWidth, "The frame sizes must match");
+static_assert(LEPONG_VECENV_PIXELS_HEIGHT == lepong::Rasterizer::skFrameHeight, "The frame sizes must match");
+
+struct LepongVecEnv
+{
+    LepongVecEnvSettings settings;
+    lepong::MatchBatch batch;
+
+    // Laid out like MatchBatch::Step expects: the agent paddles, then the opponent paddles.
+    std::vector<lepong::PaddleAction> actions;
+
+    // Draw the pixel observations.
+    lepong::WorkerGroup workers;
+
+    // The observations being drawn by the workers.
+    std::uint8_t* frames = nullptr;
+
+    // Open when the environments run in a server, the batch is then empty.
+    lepong::Net::StepChannel channel;
+    std::uint32_t nextSlot = 0;
+
+    ///
+    /// \param localCount The number of environments run by this object.
+    ///
+    LepongVecEnv(const LepongVecEnvSettings& settings, std::size_t localCount) noexcept
+        : settings(settings)
+        , batch(localCount)
+        , actions(2 * localCount)
+        , workers(settings.observation == LEPONG_OBSERVATION_PIXELS ? settings.threadCount : 1u)
+    {
+        batch.SetSeed(settings.seed);
+    }
+};
+
+static void DrawFrames(void* userData, unsigned thread, unsigned threadCount) noexcept
+{
+    const auto& kEnv = *static_cast<const LepongVecEnv*>(userData);
+    const auto kCount = kEnv.batch.Size();
+
+    const auto kBegin = kCount * thread / threadCount;
+    const auto kEnd = kCount * (thread + 1) / threadCount;
+
+    lepong::Rasterizer::DrawMatches(kEnv.batch, kBegin, kEnd, kEnv.frames + kBegin * lepong::Rasterizer::skFrameSize);
+}
+
+static void WriteObservations(LepongVecEnv& env, void* observations) noexcept
+{
+    const auto& kBatch = env.batch;
+    const auto kCount = kBatch.Size();
+
+    if (env.settings.observation == LEPONG_OBSERVATION_PIXELS)
+    {
+        env.frames = static_cast<std::uint8_t*>(observations);
+        env.workers.Run(&DrawFrames, &env);
+
+        return;
+    }
+
+    auto* values = static_cast<float*>(observations);
+
+    // The arena of the rules the batch plays with.
+    const auto& kArenaSize = kBatch.GetRules().arenaSize;
+
+    const auto kHalfArenaWidth = kArenaSize.x / 2.0f;
+    const auto kHalfArenaHeight = kArenaSize.y / 2.0f;
+    const auto kInverseArenaWidth = 1.0f / kArenaSize.x;
+
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        auto* observation = values + i * LEPONG_VECENV_VECTOR_SIZE;
+
+        const auto kSpeed = kBatch.ballSpeed[i] * kInverseArenaWidth;
+
+        observation[0] = kBatch.ballX[i] / kHalfArenaWidth - 1.0f;
+        observation[1] = kBatch.ballY[i] / kHalfArenaHeight - 1.0f;
+        observation[2] = kBatch.ballDirX[i] * kSpeed;
+        observation[3] = kBatch.ballDirY[i] * kSpeed;
+        observation[4] = kBatch.paddleY[0][i] / kHalfArenaHeight - 1.0f;
+        observation[5] = kBatch.paddleY[1][i] / kHalfArenaHeight - 1.0f;
+    }
+}
+
+///
+/// Has the server run a command and copies the results out.
+///
+/// \return 0 on success, -1 if the server is gone.
+///
+static int Exchange(LepongVecEnv& env, lepong::Net::StepCommand command, const int32_t* actions, void* observations, float* rewards, uint8_t* dones) noexcept
+{
+    auto& channel = env.channel;
+    const auto kCount = static_cast<std::size_t>(channel.GetEnvCount());
+
+    const auto kSlot = env.nextSlot;
+    env.nextSlot = (env.nextSlot + 1u) % lepong::Net::StepChannel::skSlotCount;
+
+    if (actions)
+    {
+        std::copy(actions, actions + kCount, channel.GetActions(kSlot));
+    }
+
+    std::uint32_t slot;
+    LEPONG_CHECK_OR_RETURN_VAL(channel.Submit(command, kSlot) && channel.WaitResult(slot) && slot == kSlot, -1);
+
+    const auto* kObservations = channel.GetObservations(kSlot);
+    std::copy(kObservations, kObservations + kCount * channel.GetObservationSize(), static_cast<std::uint8_t*>(observations));
+
+    if (rewards)
+    {
+        std::copy(channel.GetRewards(kSlot), channel.GetRewards(kSlot) + kCount, rewards);
+        std::copy(channel.GetDones(kSlot), channel.GetDones(kSlot) + kCount, dones);
+    }
+
+    return 0;
+}
+
+void lepong_vecenv_default_settings(LepongVecEnvSettings* settings)
+{
+    LEPONG_CHECK_OR_RETURN(settings);
+
+    settings->envCount = 1;
+    settings->seed = 0;
+    settings->frameSkip = 4;
+    settings->observation = LEPONG_OBSERVATION_VECTOR;
+    settings->tickDelta = 1.0f / 240.0f;
+    settings->threadCount = 1;
+}
+
+LepongVecEnv* lepong_vecenv_create(uint32_t envCount, uint64_t seed)
+{
+    LepongVecEnvSettings settings;
+    lepong_vecenv_default_settings(&settings);
+
+    settings.envCount = envCount;
+    settings.seed = seed;
+
+    return lepong_vecenv_create_with_settings(&settings);
+}
+
+LepongVecEnv* lepong_vecenv_create_with_settings(const LepongVecEnvSettings* settings)
+{
+    LEPONG_CHECK_OR_RETURN_VAL(settings && settings->envCount && settings->frameSkip, nullptr);
+    LEPONG_CHECK_OR_RETURN_VAL(settings->tickDelta > 0.0f, nullptr);
+
+    const auto kObservation = settings->observation;
+    LEPONG_CHECK_OR_RETURN_VAL(kObservation == LEPONG_OBSERVATION_VECTOR || kObservation == LEPONG_OBSERVATION_PIXELS, nullptr);
+
+    return new (std::nothrow) LepongVecEnv(*settings, settings->envCount);
+}
+
+void lepong_vecenv_destroy(LepongVecEnv* env)
+{
+    if (env && env->channel.IsOpen())
+    {
+        static_cast<void>(env->channel.Submit(lepong::Net::StepCommand::Close, 0));
+    }
+
+    delete env;
+}
+
+uint32_t lepong_vecenv_get_env_count(const LepongVecEnv* env)
+{
+    return env ? env->settings.envCount : 0u;
+}
+
+size_t lepong_vecenv_get_observation_size(const LepongVecEnv* env)
+{
+    LEPONG_CHECK_OR_RETURN_VAL(env, 0);
+
+    return env->settings.observation == LEPONG_OBSERVATION_PIXELS
+        ? lepong::Rasterizer::skFrameSize
+        : LEPONG_VECENV_VECTOR_SIZE * sizeof(float);
+}
+
+int lepong_vecenv_reset(LepongVecEnv* env, void* observations)
+{
+    LEPONG_CHECK_OR_RETURN_VAL(env && observations, -1);
+
+    if (env->channel.IsOpen())
+    {
+        return Exchange(*env, lepong::Net::StepCommand::Reset, nullptr, observations, nullptr, nullptr);
+    }
+
+    for (std::size_t i = 0; i < env->batch.Size(); ++i)
+    {
+        env->batch.Restart(i);
+    }
+
+    WriteObservations(*env, observations);
+    return 0;
+}
+
+int lepong_vecenv_step(LepongVecEnv* env, const int32_t* actions, void* observations, float* rewards, uint8_t* dones)
+{
+    LEPONG_CHECK_OR_RETURN_VAL(env && actions && observations && rewards && dones, -1);
+
+    if (env->channel.IsOpen())
+    {
+        return Exchange(*env, lepong::Net::StepCommand::Step, actions, observations, rewards, dones);
+    }
+
+    auto& batch = env->batch;
+    const auto kCount = batch.Size();
+
+    // New episodes wait for their first step to launch the ball.
+    batch.LaunchWaiting();
+
+    std::fill(rewards, rewards + kCount, 0.0f);
+    std::fill(dones, dones + kCount, std::uint8_t{ 0 });
+
+    for (std::uint32_t tick = 0; tick < env->settings.frameSkip; ++tick)
+    {
+        lepong::FillTrackBallActions(batch, env->actions.data());
+
+        for (std::size_t i = 0; i < kCount; ++i)
+        {
+            const auto kAction = actions[i] >= LEPONG_ACTION_STAY && actions[i] <= LEPONG_ACTION_DOWN
+                ? static_cast<lepong::PaddleAction>(actions[i])
+                : lepong::PaddleAction::Stay;
+
+            // An ended episode waits for the next step, its paddles stay where the new episode puts them.
+            env->actions[i] = dones[i] ? lepong::PaddleAction::Stay : kAction;
+            env->actions[kCount + i] = dones[i] ? lepong::PaddleAction::Stay : env->actions[kCount + i];
+        }
+
+        batch.Step(env->settings.tickDelta, env->actions.data());
+
+        // Every episode starts at 0 - 0, so any point was scored during this tick.
+        for (std::size_t i = 0; i < kCount; ++i)
+        {
+            const auto kScored = batch.scores[0][i] | batch.scores[1][i];
+
+            if (kScored)
+            {
+                rewards[i] = batch.scores[0][i] ? 1.0f : -1.0f;
+                dones[i] = 1u;
+
+                batch.Restart(i);
+            }
+        }
+    }
+
+    WriteObservations(*env, observations);
+    return 0;
+}
+
+int lepong_vecenv_serve(const char* name, const LepongVecEnvSettings* settings, LepongWait wait)
+{
+    LEPONG_CHECK_OR_RETURN_VAL(name, -1);
+
+    const std::unique_ptr<LepongVecEnv, decltype(&lepong_vecenv_destroy)> kEnv(
+        lepong_vecenv_create_with_settings(settings), &lepong_vecenv_destroy);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kEnv, -1);
+
+    lepong::Net::StepChannel channel;
+    channel.SetWait(wait == LEPONG_WAIT_POLL ? lepong::Net::StepWait::Poll : lepong::Net::StepWait::Futex);
+
+    const auto kObservationSize = static_cast<std::uint32_t>(lepong_vecenv_get_observation_size(kEnv.get()));
+    LEPONG_CHECK_OR_RETURN_VAL(channel.Create(name, settings->envCount, kObservationSize), -1);
+
+    lepong::Net::StepCommand command;
+    std::uint32_t slot;
+
+    // The environments write straight into the shared buffers.
+    while (channel.WaitCommand(command, slot) && command != lepong::Net::StepCommand::Close)
+    {
+        if (command == lepong::Net::StepCommand::Reset)
+        {
+            lepong_vecenv_reset(kEnv.get(), channel.GetObservations(slot));
+        }
+        else
+        {
+            lepong_vecenv_step(kEnv.get(), channel.GetActions(slot), channel.GetObservations(slot), channel.GetRewards(slot), channel.GetDones(slot));
+        }
+
+        channel.Complete(slot);
+    }
+
+    channel.Close();
+    return 0;
+}
+
+LepongVecEnv* lepong_vecenv_connect(const char* name, LepongWait wait)
+{
+    LEPONG_CHECK_OR_RETURN_VAL(name, nullptr);
+
+    LepongVecEnvSettings settings;
+    lepong_vecenv_default_settings(&settings);
+
+    auto* env = new (std::nothrow) LepongVecEnv(settings, 0);
+    LEPONG_CHECK_OR_RETURN_VAL(env, nullptr);
+
+    auto& channel = env->channel;
+    channel.SetWait(wait == LEPONG_WAIT_POLL ? lepong::Net::StepWait::Poll : lepong::Net::StepWait::Futex);
+
+    if (!channel.Open(name))
+    {
+        delete env;
+        return nullptr;
+    }
+
+    env->settings.envCount = channel.GetEnvCount();
+    env->settings.observation = channel.GetObservationSize() == lepong::Rasterizer::skFrameSize
+        ? LEPONG_OBSERVATION_PIXELS
+        : LEPONG_OBSERVATION_VECTOR;
+
+    return env;
+}
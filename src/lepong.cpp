@@ -9,15 +9,18 @@
 #include "lepong/lepong.h"
 #include "lepong/Window.h"
 #include "lepong/Game/Game.h"
+#include "lepong/Game/Render.h"
 #include "lepong/Graphics/Quad.h"
-#include "lepong/Math/Math.h"
+#include "lepong/Sim/Replay.h"
+#include "lepong/Sim/Timeline.h"
+#include "lepong/Time/FixedTimestep.h"
 #include "lepong/Time/Time.h"
 
 namespace lepong
 {
 
-// Hardcoded but this should be fine on most monitors (maybe a bit small for 2k+).
-static constexpr Vector2i skWinSize = { 1280, 720 };
+// The window shows the whole arena.
+static constexpr Vector2i skWinSize = Match::skArenaSize;
 
 static auto sInitialized = false;
 
@@ -31,19 +34,33 @@ static Graphics::Mesh sQuad;
 static Graphics::Mesh sTexturedQuad;
 
 // Game state.
-static bool sPlaying = false;
-static unsigned sPlayerScores[] = { 0u, 0u };
+static Match sMatch;
 
-// Ball.
-static constexpr float skBallRadius = 20.0f;
+// The state before the last tick, rendering interpolates between it and the current state.
+static Match sPreviousMatch;
 
-static Ball sBall{ skBallRadius, sTexturedQuad, sBallProgram };
+// The simulation runs at a fixed rate whatever the frame rate, catching up on at most 100ms per frame.
+static constexpr unsigned skTickRate = 240;
+static constexpr unsigned skMaxTicksPerFrame = skTickRate / 10;
 
-// Paddles.
-static constexpr Vector2f skPaddleSize = { 25.0f, 150.0f };
+static Time::FixedTimestep sTimestep{ skTickRate, skMaxTicksPerFrame };
 
-static Paddle sPaddle1{ skPaddleSize,  1.0f, sQuad, sPaddleProgram };
-static Paddle sPaddle2{ skPaddleSize, -1.0f, sQuad, sPaddleProgram };
+// Whether runs are recorded, off unless asked for since the files of the previous run are overwritten.
+static auto sRecording = false;
+
+// A recorded run is saved when the game exits, lepong_sim --replay plays it again.
+static constexpr auto skReplayPath = "lepong.lprp";
+
+static ReplayRecorder sRecorder;
+static Replay sReplay;
+
+// A recorded run is also written to a timeline as it's played, so it can be scrubbed through afterwards.
+static constexpr auto skTimelinePath = "lepong.lptl";
+
+static TimelineWriter sTimeline;
+
+// Whether the ball was launched since the last tick, for the timeline.
+static bool sLaunched = false;
 
 ///
 /// A class holding the init and cleanup functions of any item.
@@ -139,6 +156,11 @@ using ConstArrayReference = const T (&)[Size];
 template<std::size_t NumItems>
 LEPONG_NODISCARD static bool TryInitItems(ConstArrayReference<Lifetime, NumItems> lifetimes) noexcept;
 
+void SetRecording(bool record) noexcept
+{
+    sRecording = record;
+}
+
 bool Init() noexcept
 {
     LEPONG_CHECK_OR_RETURN_VAL(!sInitialized, false);
@@ -285,14 +307,9 @@ static void OnKeyUp(int key) noexcept;
 ///
 static void OnKeyDown(int key) noexcept;
 
-///
-/// Sets the ball's direction to a random diagonal direction.
-///
-static void LaunchBall() noexcept;
-
 void OnKeyEvent(int key, bool pressed) noexcept
 {
-    if (sPlaying)
+    if (sMatch.playing)
     {
         if (pressed)
         {
@@ -305,8 +322,13 @@ void OnKeyEvent(int key, bool pressed) noexcept
     }
     else if (pressed && key == VK_SPACE)
     {
-        sPlaying = true;
-        LaunchBall();
+        sMatch.Launch();
+
+        if (sRecording)
+        {
+            sRecorder.Launch();
+            sLaunched = true;
+        }
     }
 }
 
@@ -322,19 +344,19 @@ void OnKeyUp(int key) noexcept
     switch (key)
     {
     case skP2Up:
-        sPaddle2.OnMoveUpReleased();
+        sMatch.paddle2.OnMoveUpReleased();
         break;
 
     case skP2Down:
-        sPaddle2.OnMoveDownReleased();
+        sMatch.paddle2.OnMoveDownReleased();
         break;
 
     case skP1Up:
-        sPaddle1.OnMoveUpReleased();
+        sMatch.paddle1.OnMoveUpReleased();
         break;
 
     case skP1Down:
-        sPaddle1.OnMoveDownReleased();
+        sMatch.paddle1.OnMoveDownReleased();
         break;
 
     default: break;
@@ -346,33 +368,25 @@ void OnKeyDown(int key) noexcept
     switch (key)
     {
     case skP2Up:
-        sPaddle2.OnMoveUpPressed();
+        sMatch.paddle2.OnMoveUpPressed();
         break;
 
     case skP2Down:
-        sPaddle2.OnMoveDownPressed();
+        sMatch.paddle2.OnMoveDownPressed();
         break;
 
     case skP1Up:
-        sPaddle1.OnMoveUpPressed();
+        sMatch.paddle1.OnMoveUpPressed();
         break;
 
     case skP1Down:
-        sPaddle1.OnMoveDownPressed();
+        sMatch.paddle1.OnMoveDownPressed();
         break;
 
     default: break;
     }
 }
 
-void LaunchBall() noexcept
-{
-    sBall.moveSpeed = Ball::skDefaultMoveSpeed;
-
-    sBall.moveDirection = { RandomSignFloat(), RandomSignFloat() };
-    sBall.moveDirection = Normalize(sBall.moveDirection);
-}
-
 void CleanupGameWindow() noexcept
 {
     Window::DestroyWindow(sWindow);
@@ -565,14 +579,16 @@ static void OnBeginRun() noexcept;
 LEPONG_NODISCARD static float GetTimeDelta() noexcept;
 
 ///
-/// Called at each game update.
+/// Called at each game tick.
 ///
 static void OnUpdate(float delta) noexcept;
 
 ///
 /// Called at each game frame.
 ///
-static void OnRender() noexcept;
+/// \param alpha How far the frame is between the last two ticks.
+///
+static void OnRender(float alpha) noexcept;
 
 ///
 /// Called when exiting the main loop.
@@ -590,10 +606,14 @@ void Run() noexcept
     {
         sRunning = Window::PollEvents();
 
-        const auto cDelta = GetTimeDelta();
-        OnUpdate(cDelta);
+        const auto cTicks = sTimestep.Advance(GetTimeDelta());
 
-        OnRender();
+        for (unsigned i = 0; i < cTicks; ++i)
+        {
+            OnUpdate(sTimestep.GetTickDelta());
+        }
+
+        OnRender(sTimestep.GetAlpha());
     }
 
     OnFinishRun();
@@ -604,27 +624,23 @@ void Run() noexcept
 ///
 static void LogContextSpecifications() noexcept;
 
-///
-/// Resets the game state.
-///
-static void ResetGameState() noexcept;
-
-///
-/// Properly sets the paddle positions on the terrain.
-///
-static void PositionPaddlesOnTerrain() noexcept;
-
 void OnBeginRun() noexcept
 {
     Window::ShowWindow(sWindow);
     Window::SetWindowResizable(sWindow, false);
 
     LogContextSpecifications();
-    ResetGameState();
-    PositionPaddlesOnTerrain();
+    sMatch.Reset();
+    sMatch.continuousCollision = true;
+    sPreviousMatch = sMatch;
 
     const auto kCurrentTime = (unsigned)time(nullptr);
-    srand(kCurrentTime);
+    sMatch.random = Random(kCurrentTime);
+
+    LEPONG_CHECK_OR_RETURN(sRecording);
+
+    sRecorder.Begin(sMatch, sTimestep.GetTickDelta(), sReplay);
+    LEPONG_CHECK_OR_LOG(sTimeline.Open(skTimelinePath, sTimestep.GetTickDelta()), "Failed to create the timeline");
 }
 
 #define LEPONG_LOG_GL_STRING(name) \
@@ -637,24 +653,6 @@ void LogContextSpecifications() noexcept
     LEPONG_LOG_GL_STRING(gl::Renderer);
 }
 
-void ResetGameState() noexcept
-{
-    sBall.Reset(skWinSize);
-
-    sPaddle1.Reset(skWinSize);
-    sPaddle2.Reset(skWinSize);
-
-    sPlaying = false;
-}
-
-void PositionPaddlesOnTerrain() noexcept
-{
-    const auto kBorderOffset = 50.0f;
-
-    sPaddle1.position.x = kBorderOffset;
-    sPaddle2.position.x = skWinSize.x - kBorderOffset;
-}
-
 float GetTimeDelta() noexcept
 {
     static auto sLastTime = 0.0f;
@@ -666,61 +664,50 @@ float GetTimeDelta() noexcept
     return kTimeDelta;
 }
 
-///
-/// Handles ball collision with terrain sides.
-///
-static void CheckBallSideCollision() noexcept;
-
 void OnUpdate(float delta) noexcept
 {
-    sBall.Update(delta);
+    sPreviousMatch = sMatch;
 
-    sPaddle1.Update(delta, skWinSize);
-    sPaddle2.Update(delta, skWinSize);
+    if (sRecording)
+    {
+        // The key handlers already moved the paddles, record what they are doing.
+        const PaddleAction kActions[] = { GetPaddleAction(sMatch.paddle1), GetPaddleAction(sMatch.paddle2) };
+        sRecorder.Tick(kActions);
 
-    sBall.CollideWithTerrain(skWinSize);
+        sTimeline.Record(sMatch, sLaunched, kActions);
+        sLaunched = false;
+    }
 
-    const auto kCollides =
-        sBall.CollideWith(sPaddle1) ||
-        sBall.CollideWith(sPaddle2);
+    // Scoring and resetting after a point are handled by the match.
+    const auto kLostSide = sMatch.Update(delta);
 
-    if (!kCollides)
+    if (kLostSide != Side::None)
     {
-        CheckBallSideCollision();
+        // Don't interpolate the ball from the goal back to the center.
+        sPreviousMatch = sMatch;
     }
 }
 
 ///
-/// Gives the point to the player corresponding to the provided side.<br>
-/// The player who won the point is the player opposite to the provided side.
+/// \return A copy of the object at its interpolated position.
 ///
-static void UpdateScores(Side lostSide) noexcept;
-
-void CheckBallSideCollision() noexcept
+template<typename Object>
+LEPONG_NODISCARD static Object Interpolate(const Object& previous, const Object& current, float alpha) noexcept
 {
-    const auto kSide = sBall.GetTouchingSide(skWinSize);
+    auto interpolated = current;
+    interpolated.position = Lerp(previous.position, current.position, alpha);
 
-    if (kSide != Side::None)
-    {
-        UpdateScores(kSide);
-        ResetGameState();
-    }
-}
-
-void UpdateScores(Side lostSide) noexcept
-{
-    const auto kScoreIndex = 1u - static_cast<unsigned>(lostSide);
-    ++sPlayerScores[kScoreIndex];
+    return interpolated;
 }
 
-void OnRender() noexcept
+void OnRender(float alpha) noexcept
 {
     gl::Clear(gl::ColorBufferBit);
 
-    sBall.Render();
+    RenderBall(Interpolate(sPreviousMatch.ball, sMatch.ball, alpha), sTexturedQuad, sBallProgram);
 
-    sPaddle1.Render();
-    sPaddle2.Render();
+    RenderPaddle(Interpolate(sPreviousMatch.paddle1, sMatch.paddle1, alpha), sQuad, sPaddleProgram);
+    RenderPaddle(Interpolate(sPreviousMatch.paddle2, sMatch.paddle2, alpha), sQuad, sPaddleProgram);
 
     gl::SwapBuffers(sContext);
 }
@@ -728,6 +715,12 @@ void OnRender() noexcept
 void OnFinishRun() noexcept
 {
     Window::HideWindow(sWindow);
+
+    LEPONG_CHECK_OR_RETURN(sRecording);
+
+    sRecorder.End(sMatch);
+    LEPONG_CHECK_OR_LOG(SaveReplay(sReplay, skReplayPath), "Failed to save the replay");
+    LEPONG_CHECK_OR_LOG(sTimeline.Close(), "Failed to save the timeline");
 }
 
 void Cleanup() noexcept